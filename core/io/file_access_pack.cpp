@@ -31,7 +31,9 @@
 #include "file_access_pack.h"
 
 #include "core/io/file_access_encrypted.h"
+#include "core/io/marshalls.h"
 #include "core/object/script_language.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "core/version.h"
 
@@ -47,7 +49,30 @@ Error PackedData::add_pack(const String &p_path, bool p_replace_files, uint64_t
 	return ERR_FILE_UNRECOGNIZED;
 }
 
-void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted) {
+const uint8_t *PackedData::get_pack_mapping(const String &p_pack, uint64_t &r_length) {
+	MutexLock lock(mapped_packs_mutex);
+
+	HashMap<String, MappedPack>::Iterator E = mapped_packs.find(p_pack);
+	if (!E) {
+		// Failures are cached too, so unmappable packs are only tried once.
+		MappedPack mp;
+		mp.file = FileAccess::open(p_pack, FileAccess::READ);
+		if (mp.file.is_valid()) {
+			mp.data = mp.file->get_mapped_buffer();
+			if (mp.data) {
+				mp.length = mp.file->get_length();
+			} else {
+				mp.file = Ref<FileAccess>();
+			}
+		}
+		E = mapped_packs.insert(p_pack, mp);
+	}
+
+	r_length = E->value.length;
+	return E->value.data;
+}
+
+void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted, bool p_compressed) {
 	String simplified_path = p_path.simplify_path();
 	PathMD5 pmd5(simplified_path.md5_buffer());
 
@@ -55,6 +80,7 @@ void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64
 
 	PackedFile pf;
 	pf.encrypted = p_encrypted;
+	pf.compressed = p_compressed;
 	pf.pack = p_pkg_path;
 	pf.offset = p_ofs;
 	pf.size = p_size;
@@ -127,6 +153,7 @@ PackedData::~PackedData() {
 		memdelete(sources[i]);
 	}
 	_free_packed_dirs(root);
+	mapped_packs.clear();
 }
 
 //////////////////////////////////////////////////////////////////
@@ -207,7 +234,7 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 	uint32_t ver_minor = f->get_32();
 	f->get_32(); // patch number, not used for validation.
 
-	ERR_FAIL_COND_V_MSG(version != PACK_FORMAT_VERSION, false, "Pack version unsupported: " + itos(version) + ".");
+	ERR_FAIL_COND_V_MSG(version < PACK_FORMAT_VERSION_MIN || version > PACK_FORMAT_VERSION, false, "Pack version unsupported: " + itos(version) + ".");
 	ERR_FAIL_COND_V_MSG(ver_major > VERSION_MAJOR || (ver_major == VERSION_MAJOR && ver_minor > VERSION_MINOR), false, "Pack created with a newer version of the engine: " + itos(ver_major) + "." + itos(ver_minor) + ".");
 
 	uint32_t pack_flags = f->get_32();
@@ -259,7 +286,7 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 		f->get_buffer(md5, 16);
 		uint32_t flags = f->get_32();
 
-		PackedData::get_singleton()->add_path(p_path, path, ofs + p_offset, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED));
+		PackedData::get_singleton()->add_path(p_path, path, ofs + p_offset, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED), (flags & PACK_FILE_COMPRESSED));
 	}
 
 	return true;
@@ -276,8 +303,109 @@ Error FileAccessPack::open_internal(const String &p_path, int p_mode_flags) {
 	return ERR_UNAVAILABLE;
 }
 
+void FileAccessPack::_read_stored(uint64_t p_offset, uint8_t *p_dst, uint64_t p_length) const {
+	if (mapped) {
+		memcpy(p_dst, &mapped[p_offset], p_length);
+	} else {
+		f->seek(off + p_offset);
+		f->get_buffer(p_dst, p_length);
+	}
+}
+
+Error FileAccessPack::_parse_block_index() {
+	const uint32_t header_size = 16;
+	ERR_FAIL_COND_V(pf.size < header_size, ERR_FILE_CORRUPT);
+
+	uint8_t header[header_size];
+	_read_stored(0, header, header_size);
+	uint32_t mode = decode_uint32(&header[0]);
+	block_size = decode_uint32(&header[4]);
+	length = decode_uint64(&header[8]);
+
+	ERR_FAIL_COND_V(mode > Compression::MODE_BROTLI, ERR_FILE_CORRUPT);
+	ERR_FAIL_COND_V(block_size == 0 || block_size > (1 << 30), ERR_FILE_CORRUPT);
+	compression_mode = Compression::Mode(mode);
+
+	uint64_t block_count = (length + block_size - 1) / block_size;
+	ERR_FAIL_COND_V(header_size + block_count * 4 > pf.size, ERR_FILE_CORRUPT);
+
+	Vector<uint8_t> sizes;
+	sizes.resize(block_count * 4);
+	_read_stored(header_size, sizes.ptrw(), sizes.size());
+
+	block_offsets.resize(block_count + 1);
+	block_offsets[0] = header_size + block_count * 4;
+	for (uint32_t i = 0; i < block_count; i++) {
+		block_offsets[i + 1] = block_offsets[i] + decode_uint32(&sizes[i * 4]);
+	}
+	ERR_FAIL_COND_V(block_offsets[block_count] > pf.size, ERR_FILE_CORRUPT);
+
+	return OK;
+}
+
+uint32_t FileAccessPack::_get_block_length(uint32_t p_block) const {
+	return MIN((uint64_t)block_size, length - (uint64_t)p_block * block_size);
+}
+
+void FileAccessPack::_decompress_block_task(uint32_t p_index, DecompressJob *p_job) const {
+	uint32_t block = p_job->first_block + p_index;
+	uint32_t block_length = _get_block_length(block);
+	const uint8_t *src = p_job->src + (block_offsets[block] - block_offsets[p_job->first_block]);
+	int src_size = block_offsets[block + 1] - block_offsets[block];
+
+	int ret = Compression::decompress(p_job->dst + (uint64_t)p_index * block_size, block_length, src, src_size, compression_mode);
+	if (unlikely(ret != (int)block_length)) {
+		p_job->failed.set();
+		ERR_FAIL_MSG("Corrupt compressed block in pack-referenced file '" + String(pf.pack) + "'.");
+	}
+}
+
+Error FileAccessPack::_decompress_blocks(uint32_t p_first_block, uint32_t p_count, uint8_t *p_dst) const {
+	DecompressJob job;
+	job.first_block = p_first_block;
+	job.dst = p_dst;
+
+	if (mapped) {
+		job.src = &mapped[block_offsets[p_first_block]];
+	} else {
+		// Fetch the compressed blocks with a single read, only decompression runs in parallel.
+		uint64_t stored_size = block_offsets[p_first_block + p_count] - block_offsets[p_first_block];
+		if ((uint64_t)read_buffer.size() < stored_size) {
+			read_buffer.resize(stored_size);
+		}
+		_read_stored(block_offsets[p_first_block], read_buffer.ptrw(), stored_size);
+		job.src = read_buffer.ptr();
+	}
+
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	if (p_count > 1 && pool && pool->get_thread_count() > 0) {
+		WorkerThreadPool::GroupID group = pool->add_template_group_task(this, &FileAccessPack::_decompress_block_task, &job, p_count, -1, true, SNAME("FileAccessPack::decompress"));
+		pool->wait_for_group_task_completion(group);
+	} else {
+		for (uint32_t i = 0; i < p_count; i++) {
+			_decompress_block_task(i, &job);
+		}
+	}
+
+	return job.failed.is_set() ? ERR_FILE_CORRUPT : OK;
+}
+
+Error FileAccessPack::_cache_block(uint32_t p_block) const {
+	if (cached_block == p_block) {
+		return OK;
+	}
+	if (block_cache.size() < (int64_t)block_size) {
+		block_cache.resize(block_size);
+	}
+	Error err = _decompress_blocks(p_block, 1, block_cache.ptrw());
+	cached_block = err == OK ? (int64_t)p_block : -1;
+	return err;
+}
+
 bool FileAccessPack::is_open() const {
-	if (f.is_valid()) {
+	if (mapped) {
+		return true;
+	} else if (f.is_valid()) {
 		return f->is_open();
 	} else {
 		return false;
@@ -285,20 +413,22 @@ bool FileAccessPack::is_open() const {
 }
 
 void FileAccessPack::seek(uint64_t p_position) {
-	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
+	ERR_FAIL_COND_MSG(f.is_null() && !mapped, "File must be opened before use.");
 
-	if (p_position > pf.size) {
+	if (p_position > length) {
 		eof = true;
 	} else {
 		eof = false;
 	}
 
-	f->seek(off + p_position);
+	if (!mapped && !compressed) {
+		f->seek(off + p_position);
+	}
 	pos = p_position;
 }
 
 void FileAccessPack::seek_end(int64_t p_position) {
-	seek(pf.size + p_position);
+	seek(length + p_position);
 }
 
 uint64_t FileAccessPack::get_position() const {
@@ -306,7 +436,7 @@ uint64_t FileAccessPack::get_position() const {
 }
 
 uint64_t FileAccessPack::get_length() const {
-	return pf.size;
+	return length;
 }
 
 bool FileAccessPack::eof_reached() const {
@@ -314,18 +444,30 @@ bool FileAccessPack::eof_reached() const {
 }
 
 uint8_t FileAccessPack::get_8() const {
-	ERR_FAIL_COND_V_MSG(f.is_null(), 0, "File must be opened before use.");
-	if (pos >= pf.size) {
+	ERR_FAIL_COND_V_MSG(f.is_null() && !mapped, 0, "File must be opened before use.");
+	if (pos >= length) {
 		eof = true;
 		return 0;
 	}
 
+	if (compressed) {
+		if (_cache_block(pos / block_size) != OK) {
+			corrupt = true;
+			return 0;
+		}
+		return block_cache[pos++ % block_size];
+	}
+
+	if (mapped) {
+		return mapped[pos++];
+	}
+
 	pos++;
 	return f->get_8();
 }
 
 uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
-	ERR_FAIL_COND_V_MSG(f.is_null(), -1, "File must be opened before use.");
+	ERR_FAIL_COND_V_MSG(f.is_null() && !mapped, -1, "File must be opened before use.");
 	ERR_FAIL_COND_V(!p_dst && p_length > 0, -1);
 
 	if (eof) {
@@ -333,9 +475,9 @@ uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	}
 
 	int64_t to_read = p_length;
-	if (to_read + pos > pf.size) {
+	if (to_read + pos > length) {
 		eof = true;
-		to_read = (int64_t)pf.size - (int64_t)pos;
+		to_read = (int64_t)length - (int64_t)pos;
 	}
 
 	pos += to_read;
@@ -343,19 +485,66 @@ uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	if (to_read <= 0) {
 		return 0;
 	}
-	f->get_buffer(p_dst, to_read);
+
+	if (compressed) {
+		uint64_t from = pos - to_read;
+		uint64_t done = 0;
+		while (done < (uint64_t)to_read) {
+			uint32_t block = (from + done) / block_size;
+			uint32_t in_block = (from + done) % block_size;
+			uint64_t chunk = MIN((uint64_t)_get_block_length(block) - in_block, to_read - done);
+			Error err;
+
+			if (in_block == 0 && chunk == _get_block_length(block) && cached_block != block) {
+				// Whole blocks are decompressed straight into the destination, in parallel when there are several.
+				uint32_t count = 1;
+				while (block + count < block_offsets.size() - 1 && chunk + _get_block_length(block + count) <= to_read - done) {
+					chunk += _get_block_length(block + count);
+					count++;
+				}
+				err = _decompress_blocks(block, count, p_dst + done);
+			} else {
+				err = _cache_block(block);
+				if (err == OK) {
+					memcpy(p_dst + done, &block_cache[in_block], chunk);
+				}
+			}
+			if (err != OK) {
+				// Only what was read before the corrupt block is returned.
+				corrupt = true;
+				eof = false;
+				pos = from + done;
+				return done;
+			}
+			done += chunk;
+		}
+	} else if (mapped) {
+		memcpy(p_dst, &mapped[pos - to_read], to_read);
+	} else {
+		f->get_buffer(p_dst, to_read);
+	}
 
 	return to_read;
 }
 
+const uint8_t *FileAccessPack::get_mapped_buffer() const {
+	// The mapping holds the compressed blocks, not the file contents.
+	return compressed ? nullptr : mapped;
+}
+
 void FileAccessPack::set_big_endian(bool p_big_endian) {
-	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
+	ERR_FAIL_COND_MSG(f.is_null() && !mapped, "File must be opened before use.");
 
 	FileAccess::set_big_endian(p_big_endian);
-	f->set_big_endian(p_big_endian);
+	if (f.is_valid()) {
+		f->set_big_endian(p_big_endian);
+	}
 }
 
 Error FileAccessPack::get_error() const {
+	if (corrupt) {
+		return ERR_FILE_CORRUPT;
+	}
 	if (eof) {
 		return ERR_FILE_EOF;
 	}
@@ -380,34 +569,57 @@ bool FileAccessPack::file_exists(const String &p_name) {
 
 void FileAccessPack::close() {
 	f = Ref<FileAccess>();
+	mapped = nullptr;
 }
 
 FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file) :
-		pf(p_file),
-		f(FileAccess::open(pf.pack, FileAccess::READ)) {
-	ERR_FAIL_COND_MSG(f.is_null(), "Can't open pack-referenced file '" + String(pf.pack) + "'.");
-
-	f->seek(pf.offset);
+		pf(p_file) {
+	pos = 0;
+	eof = false;
 	off = pf.offset;
+	length = pf.size;
+
+	if (!pf.encrypted && PackedData::get_singleton()) {
+		uint64_t pack_length = 0;
+		const uint8_t *pack_data = PackedData::get_singleton()->get_pack_mapping(pf.pack, pack_length);
+		if (pack_data && pf.offset + pf.size <= pack_length) {
+			// Reads are served straight from the mapping, no need to open the pack again.
+			mapped = pack_data + pf.offset;
+		}
+	}
 
-	if (pf.encrypted) {
-		Ref<FileAccessEncrypted> fae;
-		fae.instantiate();
-		ERR_FAIL_COND_MSG(fae.is_null(), "Can't open encrypted pack-referenced file '" + String(pf.pack) + "'.");
+	if (!mapped) {
+		f = FileAccess::open(pf.pack, FileAccess::READ);
+		ERR_FAIL_COND_MSG(f.is_null(), "Can't open pack-referenced file '" + String(pf.pack) + "'.");
 
-		Vector<uint8_t> key;
-		key.resize(32);
-		for (int i = 0; i < key.size(); i++) {
-			key.write[i] = script_encryption_key[i];
+		f->seek(pf.offset);
+
+		if (pf.encrypted) {
+			Ref<FileAccessEncrypted> fae;
+			fae.instantiate();
+			ERR_FAIL_COND_MSG(fae.is_null(), "Can't open encrypted pack-referenced file '" + String(pf.pack) + "'.");
+
+			Vector<uint8_t> key;
+			key.resize(32);
+			for (int i = 0; i < key.size(); i++) {
+				key.write[i] = script_encryption_key[i];
+			}
+
+			Error err = fae->open_and_parse(f, key, FileAccessEncrypted::MODE_READ, false);
+			ERR_FAIL_COND_MSG(err, "Can't open encrypted pack-referenced file '" + String(pf.pack) + "'.");
+			f = fae;
+			off = 0;
 		}
+	}
 
-		Error err = fae->open_and_parse(f, key, FileAccessEncrypted::MODE_READ, false);
-		ERR_FAIL_COND_MSG(err, "Can't open encrypted pack-referenced file '" + String(pf.pack) + "'.");
-		f = fae;
-		off = 0;
+	if (pf.compressed) {
+		compressed = true;
+		Error err = _parse_block_index();
+		if (err != OK) {
+			close();
+			ERR_FAIL_MSG("Can't read compressed pack-referenced file '" + String(pf.pack) + "'.");
+		}
 	}
-	pos = 0;
-	eof = false;
 }
 
 //////////////////////////////////////////////////////////////////////////////////
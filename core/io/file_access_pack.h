@@ -33,15 +33,25 @@
 
 #include "core/io/dir_access.h"
 #include "core/io/file_access.h"
+#include "core/os/mutex.h"
 #include "core/string/print_string.h"
 #include "core/templates/hash_set.h"
 #include "core/templates/list.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/rb_map.h"
+#include "core/templates/safe_refcount.h"
 
 // Godot's packed file magic header ("GDPC" in ASCII).
 #define PACK_HEADER_MAGIC 0x43504447
-// The current packed file format version number.
-#define PACK_FORMAT_VERSION 2
+// The current packed file format version number, needed by packs with compressed entries.
+#define PACK_FORMAT_VERSION 3
+// Packs without compressed entries are written with this version, so older engine versions can still read them.
+#define PACK_FORMAT_VERSION_UNCOMPRESSED 2
+// Oldest packed file format version that can still be read.
+#define PACK_FORMAT_VERSION_MIN 2
+
+// Uncompressed size of each independently compressed block of a compressed pack entry.
+#define PACK_COMPRESSED_BLOCK_SIZE (256 * 1024)
 
 enum PackFlags {
 	PACK_DIR_ENCRYPTED = 1 << 0,
@@ -49,7 +59,8 @@ enum PackFlags {
 };
 
 enum PackFileFlags {
-	PACK_FILE_ENCRYPTED = 1 << 0
+	PACK_FILE_ENCRYPTED = 1 << 0,
+	PACK_FILE_COMPRESSED = 1 << 1, // Since format version 3.
 };
 
 class PackSource;
@@ -67,6 +78,7 @@ public:
 		uint8_t md5[16];
 		PackSource *src = nullptr;
 		bool encrypted;
+		bool compressed = false;
 	};
 
 private:
@@ -101,6 +113,17 @@ private:
 
 	Vector<PackSource *> sources;
 
+	// Packs stay open and mapped once a file in them is read, so each FileAccessPack
+	// can read from (or hand out) a view of the mapping instead of reopening the pack.
+	struct MappedPack {
+		Ref<FileAccess> file;
+		const uint8_t *data = nullptr;
+		uint64_t length = 0;
+	};
+
+	HashMap<String, MappedPack> mapped_packs;
+	Mutex mapped_packs_mutex;
+
 	PackedDir *root = nullptr;
 
 	static PackedData *singleton;
@@ -110,7 +133,7 @@ private:
 
 public:
 	void add_pack_source(PackSource *p_source);
-	void add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted = false); // for PackSource
+	void add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted = false, bool p_compressed = false); // for PackSource
 
 	void set_disabled(bool p_disabled) { disabled = p_disabled; }
 	_FORCE_INLINE_ bool is_disabled() const { return disabled; }
@@ -118,6 +141,8 @@ public:
 	static PackedData *get_singleton() { return singleton; }
 	Error add_pack(const String &p_path, bool p_replace_files, uint64_t p_offset);
 
+	const uint8_t *get_pack_mapping(const String &p_pack, uint64_t &r_length);
+
 	_FORCE_INLINE_ Ref<FileAccess> try_open_path(const String &p_path);
 	_FORCE_INLINE_ bool has_path(const String &p_path);
 
@@ -147,6 +172,35 @@ class FileAccessPack : public FileAccess {
 	mutable uint64_t pos;
 	mutable bool eof;
 	uint64_t off;
+	uint64_t length = 0;
+
+	const uint8_t *mapped = nullptr;
+
+	// Compressed entries store a block index followed by blocks that can be decompressed independently:
+	// compression mode (32 bits), block size (32 bits), uncompressed size (64 bits),
+	// then the compressed size of every block (32 bits each) and the blocks themselves.
+	bool compressed = false;
+	Compression::Mode compression_mode = Compression::MODE_ZSTD;
+	uint32_t block_size = 0;
+	LocalVector<uint64_t> block_offsets; // Relative to the entry, one extra at the end.
+	mutable Vector<uint8_t> block_cache;
+	mutable int64_t cached_block = -1;
+	mutable Vector<uint8_t> read_buffer;
+	mutable bool corrupt = false;
+
+	struct DecompressJob {
+		uint32_t first_block = 0;
+		uint8_t *dst = nullptr;
+		const uint8_t *src = nullptr; // Compressed data of the first block.
+		SafeFlag failed;
+	};
+
+	Error _parse_block_index();
+	uint32_t _get_block_length(uint32_t p_block) const;
+	void _read_stored(uint64_t p_offset, uint8_t *p_dst, uint64_t p_length) const;
+	Error _decompress_blocks(uint32_t p_first_block, uint32_t p_count, uint8_t *p_dst) const;
+	void _decompress_block_task(uint32_t p_index, DecompressJob *p_job) const;
+	Error _cache_block(uint32_t p_block) const;
 
 	Ref<FileAccess> f;
 	virtual Error open_internal(const String &p_path, int p_mode_flags) override;
@@ -172,6 +226,7 @@ public:
 	virtual uint8_t get_8() const override;
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+	virtual const uint8_t *get_mapped_buffer() const override;
 
 	virtual void set_big_endian(bool p_big_endian) override;
 
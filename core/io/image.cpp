@@ -3293,6 +3293,10 @@ uint8_t *Image::ptrw() {
 	return data.ptrw();
 }
 
+uint64_t Image::get_memory_usage_estimate() const {
+	return data.size();
+}
+
 int64_t Image::get_data_size() const {
 	return data.size();
 }
@@ -433,6 +433,8 @@ public:
 	uint8_t *ptrw();
 	int64_t get_data_size() const;
 
+	virtual uint64_t get_memory_usage_estimate() const override;
+
 	void adjust_bcs(float p_brightness, float p_contrast, float p_saturation);
 
 	void set_as_black();
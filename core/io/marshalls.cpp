@@ -2056,6 +2056,469 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 	return OK;
 }
 
+// Compact encoding.
+//
+// Every value starts with a tag byte holding the `Variant::Type` in the low 6 bits and two flags.
+// Integers and sizes are varints (integers zigzag-encoded), strings are interned per message
+// (a varint index, or 0 followed by a new string), and builtin-typed arrays store their element
+// type once instead of tagging each element. Types without a compact form are stored as a
+// varint size followed by their regular encode_variant() data.
+//
+// An optional schema describes the shape of the value in advance, so no tags are written for it:
+// - an int (a `Variant::Type` other than NIL): the value has this type and has no tag,
+// - an Array with one element: the value is an Array whose elements follow that schema,
+// - a Dictionary: the value is a Dictionary with exactly these keys. Only the values are written,
+//   in the schema's key order, each following the schema stored for its key.
+// Anything else, like null, means the value is written with its tag.
+#define COMPACT_TAG_TYPE_MASK 0x3F
+#define COMPACT_TAG_FLAG_ENCODED (1 << 6) // Payload is a size followed by encode_variant() data.
+#define COMPACT_TAG_FLAG_VALUE (1 << 7) // BOOL: true. FLOAT: stored with 32 bits.
+
+struct CompactEncodeState {
+	HashMap<String, uint32_t> strings;
+	bool full_objects = false;
+};
+
+struct CompactDecodeState {
+	Vector<String> strings;
+	bool allow_objects = false;
+};
+
+static void _encode_compact_varint(uint64_t p_value, uint8_t *&buf, int &r_len) {
+	do {
+		uint8_t byte = p_value & 0x7F;
+		p_value >>= 7;
+		if (p_value) {
+			byte |= 0x80;
+		}
+		if (buf) {
+			*(buf++) = byte;
+		}
+		r_len++;
+	} while (p_value);
+}
+
+static Error _decode_compact_varint(const uint8_t *&buf, int &len, uint64_t &r_value) {
+	r_value = 0;
+	for (int shift = 0; shift < 64; shift += 7) {
+		ERR_FAIL_COND_V(len < 1, ERR_INVALID_DATA);
+		uint8_t byte = *(buf++);
+		len--;
+		r_value |= uint64_t(byte & 0x7F) << shift;
+		if (!(byte & 0x80)) {
+			return OK;
+		}
+	}
+	ERR_FAIL_V(ERR_INVALID_DATA);
+}
+
+static Error _decode_compact_size(const uint8_t *&buf, int &len, int &r_size) {
+	uint64_t size;
+	Error err = _decode_compact_varint(buf, len, size);
+	ERR_FAIL_COND_V(err != OK, err);
+	// Every element takes at least one byte, so a size larger than the remaining data is invalid.
+	ERR_FAIL_COND_V(size > (uint64_t)len, ERR_INVALID_DATA);
+	r_size = size;
+	return OK;
+}
+
+static void _encode_compact_string(const String &p_string, CompactEncodeState &p_state, uint8_t *&buf, int &r_len) {
+	const uint32_t *index = p_state.strings.getptr(p_string);
+	if (index) {
+		_encode_compact_varint(*index + 1, buf, r_len);
+		return;
+	}
+
+	p_state.strings.insert(p_string, p_state.strings.size());
+
+	CharString utf8 = p_string.utf8();
+	_encode_compact_varint(0, buf, r_len);
+	_encode_compact_varint(utf8.length(), buf, r_len);
+	if (buf) {
+		memcpy(buf, utf8.get_data(), utf8.length());
+		buf += utf8.length();
+	}
+	r_len += utf8.length();
+}
+
+static Error _decode_compact_string(const uint8_t *&buf, int &len, CompactDecodeState &p_state, String &r_string) {
+	uint64_t index;
+	Error err = _decode_compact_varint(buf, len, index);
+	ERR_FAIL_COND_V(err != OK, err);
+
+	if (index) {
+		ERR_FAIL_COND_V(index > (uint64_t)p_state.strings.size(), ERR_INVALID_DATA);
+		r_string = p_state.strings[index - 1];
+		return OK;
+	}
+
+	uint64_t strlen;
+	err = _decode_compact_varint(buf, len, strlen);
+	ERR_FAIL_COND_V(err != OK, err);
+	ERR_FAIL_COND_V(strlen > (uint64_t)len, ERR_INVALID_DATA);
+
+	String str;
+	ERR_FAIL_COND_V(str.parse_utf8((const char *)buf, strlen) != OK, ERR_INVALID_DATA);
+	buf += strlen;
+	len -= strlen;
+
+	p_state.strings.push_back(str);
+	r_string = str;
+	return OK;
+}
+
+static bool _is_compact_schema(const Variant &p_schema) {
+	switch (p_schema.get_type()) {
+		case Variant::INT:
+			return p_schema.operator int64_t() != Variant::NIL;
+		case Variant::ARRAY:
+			return p_schema.operator Array().size() == 1;
+		case Variant::DICTIONARY:
+			return true;
+		default:
+			return false;
+	}
+}
+
+static Variant::Type _get_compact_schema_type(const Variant &p_schema) {
+	if (p_schema.get_type() == Variant::INT) {
+		int64_t type = p_schema;
+		return (type > 0 && type < Variant::VARIANT_MAX) ? Variant::Type(type) : Variant::VARIANT_MAX;
+	}
+	return p_schema.get_type();
+}
+
+static Error _encode_compact(const Variant &p_variant, const Variant &p_schema, CompactEncodeState &p_state, uint8_t *&buf, int &r_len, int p_depth);
+
+static Error _encode_compact_encoded(const Variant &p_variant, CompactEncodeState &p_state, uint8_t *&buf, int &r_len, int p_depth) {
+	int len;
+	Error err = encode_variant(p_variant, nullptr, len, p_state.full_objects, p_depth + 1);
+	ERR_FAIL_COND_V(err != OK, err);
+
+	_encode_compact_varint(len, buf, r_len);
+	if (buf) {
+		encode_variant(p_variant, buf, len, p_state.full_objects, p_depth + 1);
+		buf += len;
+	}
+	r_len += len;
+	return OK;
+}
+
+// Writes the value without a tag; `p_tagged` tells whether a tag was written just before, which
+// already holds the value of booleans and the size of floats.
+static Error _encode_compact_payload(const Variant &p_variant, const Variant &p_schema, bool p_tagged, CompactEncodeState &p_state, uint8_t *&buf, int &r_len, int p_depth) {
+	ERR_FAIL_COND_V_MSG(p_depth > Variant::MAX_RECURSION_DEPTH, ERR_OUT_OF_MEMORY, "Potential infinite recursion detected. Bailing.");
+
+	switch (p_variant.get_type()) {
+		case Variant::NIL: {
+		} break;
+		case Variant::BOOL: {
+			if (!p_tagged) {
+				if (buf) {
+					*(buf++) = p_variant.operator bool() ? 1 : 0;
+				}
+				r_len++;
+			}
+		} break;
+		case Variant::INT: {
+			int64_t val = p_variant;
+			_encode_compact_varint((uint64_t(val) << 1) ^ uint64_t(val >> 63), buf, r_len);
+		} break;
+		case Variant::FLOAT: {
+			double d = p_variant;
+			if (p_tagged && double(float(d)) == d) {
+				if (buf) {
+					encode_float(d, buf);
+					buf += 4;
+				}
+				r_len += 4;
+			} else {
+				if (buf) {
+					encode_double(d, buf);
+					buf += 8;
+				}
+				r_len += 8;
+			}
+		} break;
+		case Variant::STRING:
+		case Variant::STRING_NAME: {
+			_encode_compact_string(p_variant, p_state, buf, r_len);
+		} break;
+		case Variant::ARRAY: {
+			Array array = p_variant;
+			Variant element_schema;
+			if (p_schema.get_type() == Variant::ARRAY) {
+				element_schema = p_schema.operator Array()[0];
+			} else {
+				// Builtin-typed arrays drop the tag of every element.
+				uint32_t element_type = Variant::NIL;
+				if (array.is_typed() && array.get_typed_class_name() == StringName()) {
+					element_type = array.get_typed_builtin();
+					element_schema = element_type;
+				}
+				_encode_compact_varint(element_type, buf, r_len);
+			}
+
+			_encode_compact_varint(array.size(), buf, r_len);
+			for (int i = 0; i < array.size(); i++) {
+				Error err = _encode_compact(array[i], element_schema, p_state, buf, r_len, p_depth + 1);
+				ERR_FAIL_COND_V(err != OK, err);
+			}
+		} break;
+		case Variant::DICTIONARY: {
+			Dictionary dict = p_variant;
+			if (p_schema.get_type() == Variant::DICTIONARY) {
+				Dictionary schema = p_schema;
+				ERR_FAIL_COND_V_MSG(dict.size() != schema.size(), ERR_INVALID_PARAMETER, "Dictionary keys don't match the schema.");
+				List<Variant> keys;
+				schema.get_key_list(&keys);
+				for (const Variant &E : keys) {
+					const Variant *value = dict.getptr(E);
+					ERR_FAIL_NULL_V_MSG(value, ERR_INVALID_PARAMETER, vformat("Dictionary is missing the key \"%s\" required by the schema.", E));
+					Error err = _encode_compact(*value, schema[E], p_state, buf, r_len, p_depth + 1);
+					ERR_FAIL_COND_V(err != OK, err);
+				}
+			} else {
+				_encode_compact_varint(dict.size(), buf, r_len);
+				List<Variant> keys;
+				dict.get_key_list(&keys);
+				for (const Variant &E : keys) {
+					Error err = _encode_compact(E, Variant(), p_state, buf, r_len, p_depth + 1);
+					ERR_FAIL_COND_V(err != OK, err);
+					err = _encode_compact(dict[E], Variant(), p_state, buf, r_len, p_depth + 1);
+					ERR_FAIL_COND_V(err != OK, err);
+				}
+			}
+		} break;
+		default: {
+			return _encode_compact_encoded(p_variant, p_state, buf, r_len, p_depth);
+		}
+	}
+
+	return OK;
+}
+
+static Error _encode_compact(const Variant &p_variant, const Variant &p_schema, CompactEncodeState &p_state, uint8_t *&buf, int &r_len, int p_depth) {
+	if (_is_compact_schema(p_schema)) {
+		ERR_FAIL_COND_V_MSG(_get_compact_schema_type(p_schema) == Variant::VARIANT_MAX, ERR_INVALID_PARAMETER, "Invalid type in schema.");
+		ERR_FAIL_COND_V_MSG(p_variant.get_type() != _get_compact_schema_type(p_schema), ERR_INVALID_PARAMETER, vformat("Expected a value of type %s by the schema, got %s.", Variant::get_type_name(_get_compact_schema_type(p_schema)), Variant::get_type_name(p_variant.get_type())));
+		return _encode_compact_payload(p_variant, p_schema, false, p_state, buf, r_len, p_depth);
+	}
+
+	uint8_t tag = p_variant.get_type();
+	switch (p_variant.get_type()) {
+		case Variant::NIL:
+		case Variant::INT:
+		case Variant::STRING:
+		case Variant::STRING_NAME:
+		case Variant::DICTIONARY: {
+		} break;
+		case Variant::BOOL: {
+			if (p_variant.operator bool()) {
+				tag |= COMPACT_TAG_FLAG_VALUE;
+			}
+		} break;
+		case Variant::FLOAT: {
+			double d = p_variant;
+			if (double(float(d)) == d) {
+				tag |= COMPACT_TAG_FLAG_VALUE;
+			}
+		} break;
+		case Variant::ARRAY: {
+			// Arrays typed with a class or script keep their type through the regular encoding.
+			Array array = p_variant;
+			if (array.is_typed() && array.get_typed_class_name() != StringName()) {
+				tag |= COMPACT_TAG_FLAG_ENCODED;
+			}
+		} break;
+		default: {
+			tag |= COMPACT_TAG_FLAG_ENCODED;
+		} break;
+	}
+
+	if (buf) {
+		*(buf++) = tag;
+	}
+	r_len++;
+
+	if (tag & COMPACT_TAG_FLAG_ENCODED) {
+		return _encode_compact_encoded(p_variant, p_state, buf, r_len, p_depth);
+	}
+	return _encode_compact_payload(p_variant, Variant(), true, p_state, buf, r_len, p_depth);
+}
+
+static Error _decode_compact(Variant &r_variant, const Variant &p_schema, CompactDecodeState &p_state, const uint8_t *&buf, int &len, int p_depth);
+
+static Error _decode_compact_encoded(Variant &r_variant, CompactDecodeState &p_state, const uint8_t *&buf, int &len, int p_depth) {
+	uint64_t size;
+	Error err = _decode_compact_varint(buf, len, size);
+	ERR_FAIL_COND_V(err != OK, err);
+	ERR_FAIL_COND_V(size > (uint64_t)len, ERR_INVALID_DATA);
+
+	err = decode_variant(r_variant, buf, size, nullptr, p_state.allow_objects, p_depth + 1);
+	ERR_FAIL_COND_V(err != OK, err);
+	buf += size;
+	len -= size;
+	return OK;
+}
+
+static Error _decode_compact_payload(Variant &r_variant, Variant::Type p_type, uint8_t p_tag, const Variant &p_schema, bool p_tagged, CompactDecodeState &p_state, const uint8_t *&buf, int &len, int p_depth) {
+	ERR_FAIL_COND_V_MSG(p_depth > Variant::MAX_RECURSION_DEPTH, ERR_OUT_OF_MEMORY, "Variant is too deep. Bailing.");
+
+	switch (p_type) {
+		case Variant::NIL: {
+			r_variant = Variant();
+		} break;
+		case Variant::BOOL: {
+			if (p_tagged) {
+				r_variant = bool(p_tag & COMPACT_TAG_FLAG_VALUE);
+			} else {
+				ERR_FAIL_COND_V(len < 1, ERR_INVALID_DATA);
+				r_variant = bool(*(buf++));
+				len--;
+			}
+		} break;
+		case Variant::INT: {
+			uint64_t val;
+			Error err = _decode_compact_varint(buf, len, val);
+			ERR_FAIL_COND_V(err != OK, err);
+			r_variant = int64_t(val >> 1) ^ -int64_t(val & 1);
+		} break;
+		case Variant::FLOAT: {
+			if (p_tagged && (p_tag & COMPACT_TAG_FLAG_VALUE)) {
+				ERR_FAIL_COND_V(len < 4, ERR_INVALID_DATA);
+				r_variant = decode_float(buf);
+				buf += 4;
+				len -= 4;
+			} else {
+				ERR_FAIL_COND_V(len < 8, ERR_INVALID_DATA);
+				r_variant = decode_double(buf);
+				buf += 8;
+				len -= 8;
+			}
+		} break;
+		case Variant::STRING: {
+			String str;
+			Error err = _decode_compact_string(buf, len, p_state, str);
+			ERR_FAIL_COND_V(err != OK, err);
+			r_variant = str;
+		} break;
+		case Variant::STRING_NAME: {
+			String str;
+			Error err = _decode_compact_string(buf, len, p_state, str);
+			ERR_FAIL_COND_V(err != OK, err);
+			r_variant = StringName(str);
+		} break;
+		case Variant::ARRAY: {
+			Array array;
+			Variant element_schema;
+			if (p_schema.get_type() == Variant::ARRAY) {
+				element_schema = p_schema.operator Array()[0];
+			} else {
+				uint64_t element_type;
+				Error err = _decode_compact_varint(buf, len, element_type);
+				ERR_FAIL_COND_V(err != OK, err);
+				ERR_FAIL_COND_V(element_type >= Variant::VARIANT_MAX || element_type == Variant::OBJECT, ERR_INVALID_DATA);
+				if (element_type != Variant::NIL) {
+					array.set_typed(element_type, StringName(), Variant());
+					element_schema = element_type;
+				}
+			}
+
+			int count;
+			Error err = _decode_compact_size(buf, len, count);
+			ERR_FAIL_COND_V(err != OK, err);
+			array.resize(count);
+			for (int i = 0; i < count; i++) {
+				Variant value;
+				err = _decode_compact(value, element_schema, p_state, buf, len, p_depth + 1);
+				ERR_FAIL_COND_V(err != OK, err);
+				array[i] = value;
+			}
+			r_variant = array;
+		} break;
+		case Variant::DICTIONARY: {
+			Dictionary dict;
+			if (p_schema.get_type() == Variant::DICTIONARY) {
+				Dictionary schema = p_schema;
+				List<Variant> keys;
+				schema.get_key_list(&keys);
+				for (const Variant &E : keys) {
+					Variant value;
+					Error err = _decode_compact(value, schema[E], p_state, buf, len, p_depth + 1);
+					ERR_FAIL_COND_V(err != OK, err);
+					dict[E] = value;
+				}
+			} else {
+				int count;
+				Error err = _decode_compact_size(buf, len, count);
+				ERR_FAIL_COND_V(err != OK, err);
+				for (int i = 0; i < count; i++) {
+					Variant key;
+					err = _decode_compact(key, Variant(), p_state, buf, len, p_depth + 1);
+					ERR_FAIL_COND_V(err != OK, err);
+					Variant value;
+					err = _decode_compact(value, Variant(), p_state, buf, len, p_depth + 1);
+					ERR_FAIL_COND_V(err != OK, err);
+					dict[key] = value;
+				}
+			}
+			r_variant = dict;
+		} break;
+		default: {
+			return _decode_compact_encoded(r_variant, p_state, buf, len, p_depth);
+		}
+	}
+
+	return OK;
+}
+
+static Error _decode_compact(Variant &r_variant, const Variant &p_schema, CompactDecodeState &p_state, const uint8_t *&buf, int &len, int p_depth) {
+	if (_is_compact_schema(p_schema)) {
+		Variant::Type type = _get_compact_schema_type(p_schema);
+		ERR_FAIL_COND_V_MSG(type == Variant::VARIANT_MAX, ERR_INVALID_PARAMETER, "Invalid type in schema.");
+		return _decode_compact_payload(r_variant, type, 0, p_schema, false, p_state, buf, len, p_depth);
+	}
+
+	ERR_FAIL_COND_V(len < 1, ERR_INVALID_DATA);
+	uint8_t tag = *(buf++);
+	len--;
+
+	Variant::Type type = Variant::Type(tag & COMPACT_TAG_TYPE_MASK);
+	ERR_FAIL_COND_V(type >= Variant::VARIANT_MAX, ERR_INVALID_DATA);
+
+	if (tag & COMPACT_TAG_FLAG_ENCODED) {
+		return _decode_compact_encoded(r_variant, p_state, buf, len, p_depth);
+	}
+	return _decode_compact_payload(r_variant, type, tag, Variant(), true, p_state, buf, len, p_depth);
+}
+
+Error encode_variant_compact(const Variant &p_variant, uint8_t *r_buffer, int &r_len, const Variant &p_schema, bool p_full_objects) {
+	CompactEncodeState state;
+	state.full_objects = p_full_objects;
+
+	uint8_t *buf = r_buffer;
+	r_len = 0;
+	return _encode_compact(p_variant, p_schema, state, buf, r_len, 0);
+}
+
+Error decode_variant_compact(Variant &r_variant, const uint8_t *p_buffer, int p_len, int *r_len, const Variant &p_schema, bool p_allow_objects) {
+	CompactDecodeState state;
+	state.allow_objects = p_allow_objects;
+
+	const uint8_t *buf = p_buffer;
+	int len = p_len;
+	Error err = _decode_compact(r_variant, p_schema, state, buf, len, 0);
+	if (err != OK) {
+		return err;
+	}
+
+	if (r_len) {
+		*r_len = p_len - len;
+	}
+	return OK;
+}
+
 Vector<float> vector3_to_float32_array(const Vector3 *vecs, size_t count) {
 	// We always allocate a new array, and we don't memcpy.
 	// We also don't consider returning a pointer to the passed vectors when sizeof(real_t) == 4.
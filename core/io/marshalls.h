@@ -215,6 +215,10 @@ public:
 Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int *r_len = nullptr, bool p_allow_objects = false, int p_depth = 0);
 Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bool p_full_objects = false, int p_depth = 0);
 
+// Compact encoding with varints, per-message string interning and optional schemas, see marshalls.cpp.
+Error decode_variant_compact(Variant &r_variant, const uint8_t *p_buffer, int p_len, int *r_len = nullptr, const Variant &p_schema = Variant(), bool p_allow_objects = false);
+Error encode_variant_compact(const Variant &p_variant, uint8_t *r_buffer, int &r_len, const Variant &p_schema = Variant(), bool p_full_objects = false);
+
 Vector<float> vector3_to_float32_array(const Vector3 *vecs, size_t count);
 
 #endif // MARSHALLS_H
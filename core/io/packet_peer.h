@@ -43,6 +43,7 @@ class PacketPeer : public RefCounted {
 	GDCLASS(PacketPeer, RefCounted);
 
 	Variant _bnd_get_var(bool p_allow_objects = false);
+	Variant _bnd_get_var_compact(const Variant &p_schema = Variant(), bool p_allow_objects = false);
 
 	static void _bind_methods();
 
@@ -70,6 +71,9 @@ public:
 	virtual Error get_var(Variant &r_variant, bool p_allow_objects = false);
 	virtual Error put_var(const Variant &p_packet, bool p_full_objects = false);
 
+	Error get_var_compact(Variant &r_variant, const Variant &p_schema = Variant(), bool p_allow_objects = false);
+	Error put_var_compact(const Variant &p_packet, const Variant &p_schema = Variant(), bool p_full_objects = false);
+
 	void set_encode_buffer_max_size(int p_max_size);
 	int get_encode_buffer_max_size() const;
 
@@ -34,6 +34,8 @@
 #include "core/io/file_access.h"
 #include "core/io/file_access_encrypted.h"
 #include "core/io/file_access_pack.h" // PACK_HEADER_MAGIC, PACK_FORMAT_VERSION
+#include "core/io/marshalls.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/version.h"
 
 static int _get_pad(int p_alignment, int p_n) {
@@ -49,6 +51,7 @@ static int _get_pad(int p_alignment, int p_n) {
 void PCKPacker::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("pck_start", "pck_name", "alignment", "key", "encrypt_directory"), &PCKPacker::pck_start, DEFVAL(32), DEFVAL("0000000000000000000000000000000000000000000000000000000000000000"), DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("add_file", "pck_path", "source_path", "encrypt"), &PCKPacker::add_file, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("add_file_compressed", "pck_path", "source_path", "compression_mode", "encrypt"), &PCKPacker::add_file_compressed, DEFVAL(FileAccess::COMPRESSION_ZSTD), DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("flush", "verbose"), &PCKPacker::flush, DEFVAL(false));
 }
 
@@ -89,7 +92,7 @@ Error PCKPacker::pck_start(const String &p_file, int p_alignment, const String &
 	alignment = p_alignment;
 
 	file->store_32(PACK_HEADER_MAGIC);
-	file->store_32(PACK_FORMAT_VERSION);
+	file->store_32(PACK_FORMAT_VERSION_UNCOMPRESSED); // Raised on flush if any entry is compressed.
 	file->store_32(VERSION_MAJOR);
 	file->store_32(VERSION_MINOR);
 	file->store_32(VERSION_PATCH);
@@ -106,7 +109,26 @@ Error PCKPacker::pck_start(const String &p_file, int p_alignment, const String &
 	return OK;
 }
 
+void PCKPacker::_compress_block(uint32_t p_index, CompressJob *p_job) {
+	uint64_t from = (uint64_t)p_index * PACK_COMPRESSED_BLOCK_SIZE;
+	int block_length = MIN((uint64_t)PACK_COMPRESSED_BLOCK_SIZE, p_job->size - from);
+
+	Vector<uint8_t> &block = p_job->blocks[p_index];
+	block.resize(Compression::get_max_compressed_buffer_size(block_length, p_job->mode));
+	int compressed_size = Compression::compress(block.ptrw(), p_job->src + from, block_length, p_job->mode);
+	block.resize(MAX(compressed_size, 0));
+}
+
 Error PCKPacker::add_file(const String &p_file, const String &p_src, bool p_encrypt) {
+	return _add_file(p_file, p_src, p_encrypt, false, Compression::MODE_ZSTD);
+}
+
+Error PCKPacker::add_file_compressed(const String &p_file, const String &p_src, FileAccess::CompressionMode p_compression_mode, bool p_encrypt) {
+	ERR_FAIL_COND_V_MSG(p_compression_mode == FileAccess::COMPRESSION_BROTLI, ERR_INVALID_PARAMETER, "Brotli can only be used for decompression.");
+	return _add_file(p_file, p_src, p_encrypt, true, Compression::Mode(p_compression_mode));
+}
+
+Error PCKPacker::_add_file(const String &p_file, const String &p_src, bool p_encrypt, bool p_compress, Compression::Mode p_mode) {
 	ERR_FAIL_COND_V_MSG(file.is_null(), ERR_INVALID_PARAMETER, "File must be opened before use.");
 
 	Ref<FileAccess> f = FileAccess::open(p_src, FileAccess::READ);
@@ -133,6 +155,47 @@ Error PCKPacker::add_file(const String &p_file, const String &p_src, bool p_encr
 	}
 	pf.encrypted = p_encrypt;
 
+	if (p_compress) {
+		// Blocks are compressed independently so they can be read at random and decompressed in parallel.
+		CompressJob job;
+		job.src = data.ptr();
+		job.size = data.size();
+		job.mode = p_mode;
+		uint32_t block_count = (job.size + PACK_COMPRESSED_BLOCK_SIZE - 1) / PACK_COMPRESSED_BLOCK_SIZE;
+		job.blocks.resize(block_count);
+
+		WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+		if (block_count > 1 && pool && pool->get_thread_count() > 0) {
+			WorkerThreadPool::GroupID group = pool->add_template_group_task(this, &PCKPacker::_compress_block, &job, block_count, -1, true, SNAME("PCKPacker::compress"));
+			pool->wait_for_group_task_completion(group);
+		} else {
+			for (uint32_t i = 0; i < block_count; i++) {
+				_compress_block(i, &job);
+			}
+		}
+
+		uint64_t payload_size = 16 + block_count * 4;
+		for (uint32_t i = 0; i < block_count; i++) {
+			ERR_FAIL_COND_V_MSG(job.blocks[i].is_empty(), ERR_CANT_CREATE, "Can't compress file: " + p_src + ".");
+			payload_size += job.blocks[i].size();
+		}
+
+		pf.compressed_data.resize(payload_size);
+		uint8_t *w = pf.compressed_data.ptrw();
+		encode_uint32(p_mode, &w[0]);
+		encode_uint32(PACK_COMPRESSED_BLOCK_SIZE, &w[4]);
+		encode_uint64(job.size, &w[8]);
+		uint64_t block_ofs = 16 + block_count * 4;
+		for (uint32_t i = 0; i < block_count; i++) {
+			encode_uint32(job.blocks[i].size(), &w[16 + i * 4]);
+			memcpy(&w[block_ofs], job.blocks[i].ptr(), job.blocks[i].size());
+			block_ofs += job.blocks[i].size();
+		}
+
+		pf.compressed = true;
+		pf.size = payload_size;
+	}
+
 	uint64_t _size = pf.size;
 	if (p_encrypt) { // Add encryption overhead.
 		if (_size % 16) { // Pad to encryption block size.
@@ -195,6 +258,9 @@ Error PCKPacker::flush(bool p_verbose) {
 		if (files[i].encrypted) {
 			flags |= PACK_FILE_ENCRYPTED;
 		}
+		if (files[i].compressed) {
+			flags |= PACK_FILE_COMPRESSED;
+		}
 		fhead->store_32(flags);
 	}
 
@@ -211,6 +277,13 @@ Error PCKPacker::flush(bool p_verbose) {
 	int64_t file_base = file->get_position();
 	file->seek(file_base_ofs);
 	file->store_64(file_base); // update files base
+	for (int i = 0; i < files.size(); i++) {
+		if (files[i].compressed) {
+			file->seek(sizeof(uint32_t)); // Right after the magic.
+			file->store_32(PACK_FORMAT_VERSION);
+			break;
+		}
+	}
 	file->seek(file_base);
 
 	const uint32_t buf_max = 65536;
@@ -218,9 +291,6 @@ Error PCKPacker::flush(bool p_verbose) {
 
 	int count = 0;
 	for (int i = 0; i < files.size(); i++) {
-		Ref<FileAccess> src = FileAccess::open(files[i].src_path, FileAccess::READ);
-		uint64_t to_write = files[i].size;
-
 		Ref<FileAccess> ftmp = file;
 		if (files[i].encrypted) {
 			fae.instantiate();
@@ -231,10 +301,18 @@ Error PCKPacker::flush(bool p_verbose) {
 			ftmp = fae;
 		}
 
-		while (to_write > 0) {
-			uint64_t read = src->get_buffer(buf, MIN(to_write, buf_max));
-			ftmp->store_buffer(buf, read);
-			to_write -= read;
+		if (files[i].compressed) {
+			ftmp->store_buffer(files[i].compressed_data);
+			files.write[i].compressed_data.clear();
+		} else {
+			Ref<FileAccess> src = FileAccess::open(files[i].src_path, FileAccess::READ);
+			uint64_t to_write = files[i].size;
+
+			while (to_write > 0) {
+				uint64_t read = src->get_buffer(buf, MIN(to_write, buf_max));
+				ftmp->store_buffer(buf, read);
+				to_write -= read;
+			}
 		}
 
 		if (fae.is_valid()) {
@@ -31,9 +31,9 @@
 #ifndef PCK_PACKER_H
 #define PCK_PACKER_H
 
+#include "core/io/file_access.h"
 #include "core/object/ref_counted.h"
-
-class FileAccess;
+#include "core/templates/local_vector.h"
 
 class PCKPacker : public RefCounted {
 	GDCLASS(PCKPacker, RefCounted);
@@ -53,13 +53,26 @@ class PCKPacker : public RefCounted {
 		uint64_t ofs = 0;
 		uint64_t size = 0;
 		bool encrypted = false;
+		bool compressed = false;
 		Vector<uint8_t> md5;
+		Vector<uint8_t> compressed_data; // Block index and blocks, kept until flush().
 	};
 	Vector<File> files;
 
+	struct CompressJob {
+		const uint8_t *src = nullptr;
+		uint64_t size = 0;
+		Compression::Mode mode = Compression::MODE_ZSTD;
+		LocalVector<Vector<uint8_t>> blocks;
+	};
+
+	void _compress_block(uint32_t p_index, CompressJob *p_job);
+	Error _add_file(const String &p_file, const String &p_src, bool p_encrypt, bool p_compress, Compression::Mode p_mode);
+
 public:
 	Error pck_start(const String &p_file, int p_alignment = 32, const String &p_key = "0000000000000000000000000000000000000000000000000000000000000000", bool p_encrypt_directory = false);
 	Error add_file(const String &p_file, const String &p_src, bool p_encrypt = false);
+	Error add_file_compressed(const String &p_file, const String &p_src, FileAccess::CompressionMode p_compression_mode = FileAccess::COMPRESSION_ZSTD, bool p_encrypt = false);
 	Error flush(bool p_verbose = false);
 
 	PCKPacker() {}
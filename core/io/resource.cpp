@@ -415,6 +415,10 @@ void Resource::_take_over_path(const String &p_path) {
 	set_path(p_path, true);
 }
 
+uint64_t Resource::get_memory_usage_estimate() const {
+	return 0;
+}
+
 RID Resource::get_rid() const {
 	if (get_script_instance()) {
 		Callable::CallError ce;
@@ -584,6 +588,9 @@ Resource::~Resource() {
 }
 
 HashMap<String, Resource *> ResourceCache::resources;
+LRUCache<String, ResourceCache::RetainedResource> ResourceCache::retained_resources(INT32_MAX);
+uint64_t ResourceCache::retained_size = 0;
+uint64_t ResourceCache::retained_budget = 0;
 #ifdef TOOLS_ENABLED
 HashMap<String, HashMap<String, String>> ResourceCache::resource_path_cache;
 #endif
@@ -683,3 +690,87 @@ int ResourceCache::get_cached_resource_count() {
 
 	return rc;
 }
+
+// Accounted for every retained resource, so that the budget also bounds how many of them are kept.
+#define RETAINED_RESOURCE_MIN_SIZE 1024
+
+void ResourceCache::retain(const Ref<Resource> &p_resource) {
+	if (retained_budget == 0 || p_resource.is_null() || p_resource->is_built_in()) {
+		return;
+	}
+	const String &path = p_resource->get_path();
+
+	lock.lock();
+	Resource **cached = resources.getptr(path);
+	// Resources loaded bypassing the cache aren't worth keeping around.
+	bool retainable = cached && *cached == p_resource.ptr();
+	const RetainedResource *retained = retainable ? retained_resources.getptr(path) : nullptr;
+	bool already_retained = retained && retained->resource == p_resource; // Refreshed by the lookup.
+	lock.unlock();
+
+	if (!retainable || already_retained) {
+		return;
+	}
+
+	// Estimating may involve querying servers, so it's done without holding the lock.
+	uint64_t size = MAX(p_resource->get_memory_usage_estimate(), (uint64_t)RETAINED_RESOURCE_MIN_SIZE);
+
+	// Released after unlocking, since freeing resources involves the cache as well.
+	LocalVector<Ref<Resource>> evicted;
+
+	lock.lock();
+	retained = retained_resources.getptr(path);
+	if (retained) {
+		retained_size -= retained->size;
+		evicted.push_back(retained->resource);
+		retained_resources.erase(path);
+	}
+	RetainedResource entry;
+	entry.resource = p_resource;
+	entry.size = size;
+	retained_resources.insert(path, entry);
+	retained_size += size;
+	_trim_retained(evicted);
+	lock.unlock();
+}
+
+void ResourceCache::_trim_retained(LocalVector<Ref<Resource>> &r_evicted) {
+	while (retained_size > retained_budget && retained_resources.get_size()) {
+		const RetainedResource &lru = retained_resources.get_back();
+		retained_size -= lru.size;
+		r_evicted.push_back(lru.resource);
+		retained_resources.pop_back();
+	}
+}
+
+void ResourceCache::clear_retained() {
+	LocalVector<Ref<Resource>> evicted;
+
+	lock.lock();
+	while (retained_resources.get_size()) {
+		evicted.push_back(retained_resources.get_back().resource);
+		retained_resources.pop_back();
+	}
+	retained_size = 0;
+	lock.unlock();
+}
+
+void ResourceCache::set_retained_budget(uint64_t p_bytes) {
+	LocalVector<Ref<Resource>> evicted;
+
+	lock.lock();
+	retained_budget = p_bytes;
+	_trim_retained(evicted);
+	lock.unlock();
+}
+
+uint64_t ResourceCache::get_retained_budget() {
+	return retained_budget;
+}
+
+uint64_t ResourceCache::get_retained_size() {
+	lock.lock();
+	uint64_t size = retained_size;
+	lock.unlock();
+	return size;
+}
@@ -35,6 +35,7 @@
 #include "core/object/class_db.h"
 #include "core/object/gdvirtual.gen.inc"
 #include "core/object/ref_counted.h"
+#include "core/templates/lru.h"
 #include "core/templates/safe_refcount.h"
 #include "core/templates/self_list.h"
 
@@ -142,6 +143,9 @@ public:
 
 	virtual RID get_rid() const; // some resources may offer conversion to RID
 
+	// Rough amount of memory held by the resource, including server-side data (textures, meshes, etc.).
+	virtual uint64_t get_memory_usage_estimate() const;
+
 #ifdef TOOLS_ENABLED
 	//helps keep IDs same number when loading/saving scenes. -1 clears ID and it Returns -1 when no id stored
 	void set_id_for_path(const String &p_path, const String &p_id);
@@ -157,6 +161,16 @@ class ResourceCache {
 	friend class ResourceLoader; //need the lock
 	static Mutex lock;
 	static HashMap<String, Resource *> resources;
+
+	// Recently used resources, kept alive so they can be reacquired without reloading.
+	struct RetainedResource {
+		Ref<Resource> resource;
+		uint64_t size = 0;
+	};
+	static LRUCache<String, RetainedResource> retained_resources;
+	static uint64_t retained_size;
+	static uint64_t retained_budget;
+	static void _trim_retained(LocalVector<Ref<Resource>> &r_evicted);
 #ifdef TOOLS_ENABLED
 	static HashMap<String, HashMap<String, String>> resource_path_cache; // Each tscn has a set of resource paths and IDs.
 	static RWLock path_cache_lock;
@@ -170,6 +184,14 @@ public:
 	static Ref<Resource> get_ref(const String &p_path);
 	static void get_cached_resources(List<Ref<Resource>> *p_resources);
 	static int get_cached_resource_count();
+
+	// Retained resources are handed out as they are, so files rewritten at runtime (e.g. in user://)
+	// keep loading their old contents until evicted or `clear_retained()` is called.
+	static void retain(const Ref<Resource> &p_resource);
+	static void clear_retained();
+	static void set_retained_budget(uint64_t p_bytes);
+	static uint64_t get_retained_budget();
+	static uint64_t get_retained_size();
 };
 
 #endif // RESOURCE_H
@@ -33,10 +33,12 @@
 #include "core/config/project_settings.h"
 #include "core/io/dir_access.h"
 #include "core/io/file_access_compressed.h"
+#include "core/io/file_access_memory.h"
 #include "core/io/image.h"
 #include "core/io/marshalls.h"
 #include "core/io/missing_resource.h"
 #include "core/object/script_language.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/version.h"
 
 //#define print_bl(m_what) print_line(m_what)
@@ -100,11 +102,11 @@ enum {
 	FORMAT_VERSION_NO_NODEPATH_PROPERTY = 3,
 };
 
-void ResourceLoaderBinary::_advance_padding(uint32_t p_len) {
+void ResourceLoaderBinary::_advance_padding(Ref<FileAccess> &p_f, uint32_t p_len) {
 	uint32_t extra = 4 - (p_len % 4);
 	if (extra < 4) {
 		for (uint32_t i = 0; i < extra; i++) {
-			f->get_8(); //pad to 32
+			p_f->get_8(); //pad to 32
 		}
 	}
 }
@@ -153,19 +155,19 @@ static Error read_reals(real_t *dst, Ref<FileAccess> &f, size_t count) {
 	return OK;
 }
 
-StringName ResourceLoaderBinary::_get_string() {
-	uint32_t id = f->get_32();
+StringName ResourceLoaderBinary::_get_string(Ref<FileAccess> &p_f, Vector<char> &r_str_buf) const {
+	uint32_t id = p_f->get_32();
 	if (id & 0x80000000) {
 		uint32_t len = id & 0x7FFFFFFF;
-		if ((int)len > str_buf.size()) {
-			str_buf.resize(len);
+		if ((int)len > r_str_buf.size()) {
+			r_str_buf.resize(len);
 		}
 		if (len == 0) {
 			return StringName();
 		}
-		f->get_buffer((uint8_t *)&str_buf[0], len);
+		p_f->get_buffer((uint8_t *)&r_str_buf[0], len);
 		String s;
-		s.parse_utf8(&str_buf[0]);
+		s.parse_utf8(&r_str_buf[0]);
 		return s;
 	}
 
@@ -173,7 +175,11 @@ StringName ResourceLoaderBinary::_get_string() {
 }
 
 Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
-	uint32_t prop_type = f->get_32();
+	return _parse_variant(f, str_buf, r_v);
+}
+
+Error ResourceLoaderBinary::_parse_variant(Ref<FileAccess> &p_f, Vector<char> &r_str_buf, Variant &r_v) {
+	uint32_t prop_type = p_f->get_32();
 	print_bl("find property of type: " + itos(prop_type));
 
 	switch (prop_type) {
@@ -181,185 +187,185 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			r_v = Variant();
 		} break;
 		case VARIANT_BOOL: {
-			r_v = bool(f->get_32());
+			r_v = bool(p_f->get_32());
 		} break;
 		case VARIANT_INT: {
-			r_v = int(f->get_32());
+			r_v = int(p_f->get_32());
 		} break;
 		case VARIANT_INT64: {
-			r_v = int64_t(f->get_64());
+			r_v = int64_t(p_f->get_64());
 		} break;
 		case VARIANT_FLOAT: {
-			r_v = f->get_real();
+			r_v = p_f->get_real();
 		} break;
 		case VARIANT_DOUBLE: {
-			r_v = f->get_double();
+			r_v = p_f->get_double();
 		} break;
 		case VARIANT_STRING: {
-			r_v = get_unicode_string();
+			r_v = _get_unicode_string(p_f, r_str_buf);
 		} break;
 		case VARIANT_VECTOR2: {
 			Vector2 v;
-			v.x = f->get_real();
-			v.y = f->get_real();
+			v.x = p_f->get_real();
+			v.y = p_f->get_real();
 			r_v = v;
 
 		} break;
 		case VARIANT_VECTOR2I: {
 			Vector2i v;
-			v.x = f->get_32();
-			v.y = f->get_32();
+			v.x = p_f->get_32();
+			v.y = p_f->get_32();
 			r_v = v;
 
 		} break;
 		case VARIANT_RECT2: {
 			Rect2 v;
-			v.position.x = f->get_real();
-			v.position.y = f->get_real();
-			v.size.x = f->get_real();
-			v.size.y = f->get_real();
+			v.position.x = p_f->get_real();
+			v.position.y = p_f->get_real();
+			v.size.x = p_f->get_real();
+			v.size.y = p_f->get_real();
 			r_v = v;
 
 		} break;
 		case VARIANT_RECT2I: {
 			Rect2i v;
-			v.position.x = f->get_32();
-			v.position.y = f->get_32();
-			v.size.x = f->get_32();
-			v.size.y = f->get_32();
+			v.position.x = p_f->get_32();
+			v.position.y = p_f->get_32();
+			v.size.x = p_f->get_32();
+			v.size.y = p_f->get_32();
 			r_v = v;
 
 		} break;
 		case VARIANT_VECTOR3: {
 			Vector3 v;
-			v.x = f->get_real();
-			v.y = f->get_real();
-			v.z = f->get_real();
+			v.x = p_f->get_real();
+			v.y = p_f->get_real();
+			v.z = p_f->get_real();
 			r_v = v;
 		} break;
 		case VARIANT_VECTOR3I: {
 			Vector3i v;
-			v.x = f->get_32();
-			v.y = f->get_32();
-			v.z = f->get_32();
+			v.x = p_f->get_32();
+			v.y = p_f->get_32();
+			v.z = p_f->get_32();
 			r_v = v;
 		} break;
 		case VARIANT_VECTOR4: {
 			Vector4 v;
-			v.x = f->get_real();
-			v.y = f->get_real();
-			v.z = f->get_real();
-			v.w = f->get_real();
+			v.x = p_f->get_real();
+			v.y = p_f->get_real();
+			v.z = p_f->get_real();
+			v.w = p_f->get_real();
 			r_v = v;
 		} break;
 		case VARIANT_VECTOR4I: {
 			Vector4i v;
-			v.x = f->get_32();
-			v.y = f->get_32();
-			v.z = f->get_32();
-			v.w = f->get_32();
+			v.x = p_f->get_32();
+			v.y = p_f->get_32();
+			v.z = p_f->get_32();
+			v.w = p_f->get_32();
 			r_v = v;
 		} break;
 		case VARIANT_PLANE: {
 			Plane v;
-			v.normal.x = f->get_real();
-			v.normal.y = f->get_real();
-			v.normal.z = f->get_real();
-			v.d = f->get_real();
+			v.normal.x = p_f->get_real();
+			v.normal.y = p_f->get_real();
+			v.normal.z = p_f->get_real();
+			v.d = p_f->get_real();
 			r_v = v;
 		} break;
 		case VARIANT_QUATERNION: {
 			Quaternion v;
-			v.x = f->get_real();
-			v.y = f->get_real();
-			v.z = f->get_real();
-			v.w = f->get_real();
+			v.x = p_f->get_real();
+			v.y = p_f->get_real();
+			v.z = p_f->get_real();
+			v.w = p_f->get_real();
 			r_v = v;
 
 		} break;
 		case VARIANT_AABB: {
 			AABB v;
-			v.position.x = f->get_real();
-			v.position.y = f->get_real();
-			v.position.z = f->get_real();
-			v.size.x = f->get_real();
-			v.size.y = f->get_real();
-			v.size.z = f->get_real();
+			v.position.x = p_f->get_real();
+			v.position.y = p_f->get_real();
+			v.position.z = p_f->get_real();
+			v.size.x = p_f->get_real();
+			v.size.y = p_f->get_real();
+			v.size.z = p_f->get_real();
 			r_v = v;
 
 		} break;
 		case VARIANT_TRANSFORM2D: {
 			Transform2D v;
-			v.columns[0].x = f->get_real();
-			v.columns[0].y = f->get_real();
-			v.columns[1].x = f->get_real();
-			v.columns[1].y = f->get_real();
-			v.columns[2].x = f->get_real();
-			v.columns[2].y = f->get_real();
+			v.columns[0].x = p_f->get_real();
+			v.columns[0].y = p_f->get_real();
+			v.columns[1].x = p_f->get_real();
+			v.columns[1].y = p_f->get_real();
+			v.columns[2].x = p_f->get_real();
+			v.columns[2].y = p_f->get_real();
 			r_v = v;
 
 		} break;
 		case VARIANT_BASIS: {
 			Basis v;
-			v.rows[0].x = f->get_real();
-			v.rows[0].y = f->get_real();
-			v.rows[0].z = f->get_real();
-			v.rows[1].x = f->get_real();
-			v.rows[1].y = f->get_real();
-			v.rows[1].z = f->get_real();
-			v.rows[2].x = f->get_real();
-			v.rows[2].y = f->get_real();
-			v.rows[2].z = f->get_real();
+			v.rows[0].x = p_f->get_real();
+			v.rows[0].y = p_f->get_real();
+			v.rows[0].z = p_f->get_real();
+			v.rows[1].x = p_f->get_real();
+			v.rows[1].y = p_f->get_real();
+			v.rows[1].z = p_f->get_real();
+			v.rows[2].x = p_f->get_real();
+			v.rows[2].y = p_f->get_real();
+			v.rows[2].z = p_f->get_real();
 			r_v = v;
 
 		} break;
 		case VARIANT_TRANSFORM3D: {
 			Transform3D v;
-			v.basis.rows[0].x = f->get_real();
-			v.basis.rows[0].y = f->get_real();
-			v.basis.rows[0].z = f->get_real();
-			v.basis.rows[1].x = f->get_real();
-			v.basis.rows[1].y = f->get_real();
-			v.basis.rows[1].z = f->get_real();
-			v.basis.rows[2].x = f->get_real();
-			v.basis.rows[2].y = f->get_real();
-			v.basis.rows[2].z = f->get_real();
-			v.origin.x = f->get_real();
-			v.origin.y = f->get_real();
-			v.origin.z = f->get_real();
+			v.basis.rows[0].x = p_f->get_real();
+			v.basis.rows[0].y = p_f->get_real();
+			v.basis.rows[0].z = p_f->get_real();
+			v.basis.rows[1].x = p_f->get_real();
+			v.basis.rows[1].y = p_f->get_real();
+			v.basis.rows[1].z = p_f->get_real();
+			v.basis.rows[2].x = p_f->get_real();
+			v.basis.rows[2].y = p_f->get_real();
+			v.basis.rows[2].z = p_f->get_real();
+			v.origin.x = p_f->get_real();
+			v.origin.y = p_f->get_real();
+			v.origin.z = p_f->get_real();
 			r_v = v;
 		} break;
 		case VARIANT_PROJECTION: {
 			Projection v;
-			v.columns[0].x = f->get_real();
-			v.columns[0].y = f->get_real();
-			v.columns[0].z = f->get_real();
-			v.columns[0].w = f->get_real();
-			v.columns[1].x = f->get_real();
-			v.columns[1].y = f->get_real();
-			v.columns[1].z = f->get_real();
-			v.columns[1].w = f->get_real();
-			v.columns[2].x = f->get_real();
-			v.columns[2].y = f->get_real();
-			v.columns[2].z = f->get_real();
-			v.columns[2].w = f->get_real();
-			v.columns[3].x = f->get_real();
-			v.columns[3].y = f->get_real();
-			v.columns[3].z = f->get_real();
-			v.columns[3].w = f->get_real();
+			v.columns[0].x = p_f->get_real();
+			v.columns[0].y = p_f->get_real();
+			v.columns[0].z = p_f->get_real();
+			v.columns[0].w = p_f->get_real();
+			v.columns[1].x = p_f->get_real();
+			v.columns[1].y = p_f->get_real();
+			v.columns[1].z = p_f->get_real();
+			v.columns[1].w = p_f->get_real();
+			v.columns[2].x = p_f->get_real();
+			v.columns[2].y = p_f->get_real();
+			v.columns[2].z = p_f->get_real();
+			v.columns[2].w = p_f->get_real();
+			v.columns[3].x = p_f->get_real();
+			v.columns[3].y = p_f->get_real();
+			v.columns[3].z = p_f->get_real();
+			v.columns[3].w = p_f->get_real();
 			r_v = v;
 		} break;
 		case VARIANT_COLOR: {
 			Color v; // Colors should always be in single-precision.
-			v.r = f->get_float();
-			v.g = f->get_float();
-			v.b = f->get_float();
-			v.a = f->get_float();
+			v.r = p_f->get_float();
+			v.g = p_f->get_float();
+			v.b = p_f->get_float();
+			v.a = p_f->get_float();
 			r_v = v;
 
 		} break;
 		case VARIANT_STRING_NAME: {
-			r_v = StringName(get_unicode_string());
+			r_v = StringName(_get_unicode_string(p_f, r_str_buf));
 		} break;
 
 		case VARIANT_NODE_PATH: {
@@ -367,8 +373,8 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			Vector<StringName> subnames;
 			bool absolute;
 
-			int name_count = f->get_16();
-			uint32_t subname_count = f->get_16();
+			int name_count = p_f->get_16();
+			uint32_t subname_count = p_f->get_16();
 			absolute = subname_count & 0x8000;
 			subname_count &= 0x7FFF;
 			if (ver_format < FORMAT_VERSION_NO_NODEPATH_PROPERTY) {
@@ -376,10 +382,10 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			}
 
 			for (int i = 0; i < name_count; i++) {
-				names.push_back(_get_string());
+				names.push_back(_get_string(p_f, r_str_buf));
 			}
 			for (uint32_t i = 0; i < subname_count; i++) {
-				subnames.push_back(_get_string());
+				subnames.push_back(_get_string(p_f, r_str_buf));
 			}
 
 			NodePath np = NodePath(names, subnames, absolute);
@@ -388,10 +394,10 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 
 		} break;
 		case VARIANT_RID: {
-			r_v = f->get_32();
+			r_v = p_f->get_32();
 		} break;
 		case VARIANT_OBJECT: {
-			uint32_t objtype = f->get_32();
+			uint32_t objtype = p_f->get_32();
 
 			switch (objtype) {
 				case OBJECT_EMPTY: {
@@ -399,7 +405,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 
 				} break;
 				case OBJECT_INTERNAL_RESOURCE: {
-					uint32_t index = f->get_32();
+					uint32_t index = p_f->get_32();
 					String path;
 
 					if (using_named_scene_ids) { // New format.
@@ -410,18 +416,19 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 					}
 
 					//always use internal cache for loading internal resources
-					if (!internal_index_cache.has(path)) {
+					const Ref<Resource> *cached = internal_index_cache.getptr(path);
+					if (!cached) {
 						WARN_PRINT(String("Couldn't load resource (no cache): " + path).utf8().get_data());
 						r_v = Variant();
 					} else {
-						r_v = internal_index_cache[path];
+						r_v = *cached;
 					}
 				} break;
 				case OBJECT_EXTERNAL_RESOURCE: {
 					//old file format, still around for compatibility
 
-					String exttype = get_unicode_string();
-					String path = get_unicode_string();
+					String exttype = _get_unicode_string(p_f, r_str_buf);
+					String path = _get_unicode_string(p_f, r_str_buf);
 
 					if (!path.contains("://") && path.is_relative_path()) {
 						// path is relative to file being loaded, so convert to a resource path
@@ -442,13 +449,13 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 				} break;
 				case OBJECT_EXTERNAL_RESOURCE_INDEX: {
 					//new file format, just refers to an index in the external list
-					int erindex = f->get_32();
+					int erindex = p_f->get_32();
 
 					if (erindex < 0 || erindex >= external_resources.size()) {
 						WARN_PRINT("Broken external resource! (index out of size)");
 						r_v = Variant();
 					} else {
-						Ref<ResourceLoader::LoadToken> &load_token = external_resources.write[erindex].load_token;
+						const Ref<ResourceLoader::LoadToken> &load_token = external_resources[erindex].load_token;
 						if (load_token.is_valid()) { // If not valid, it's OK since then we know this load accepts broken dependencies.
 							Error err;
 							Ref<Resource> res = ResourceLoader::_load_complete(*load_token.ptr(), &err);
@@ -480,28 +487,28 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 		} break;
 
 		case VARIANT_DICTIONARY: {
-			uint32_t len = f->get_32();
+			uint32_t len = p_f->get_32();
 			Dictionary d; //last bit means shared
 			len &= 0x7FFFFFFF;
 			for (uint32_t i = 0; i < len; i++) {
 				Variant key;
-				Error err = parse_variant(key);
+				Error err = _parse_variant(p_f, r_str_buf, key);
 				ERR_FAIL_COND_V_MSG(err, ERR_FILE_CORRUPT, "Error when trying to parse Variant.");
 				Variant value;
-				err = parse_variant(value);
+				err = _parse_variant(p_f, r_str_buf, value);
 				ERR_FAIL_COND_V_MSG(err, ERR_FILE_CORRUPT, "Error when trying to parse Variant.");
 				d[key] = value;
 			}
 			r_v = d;
 		} break;
 		case VARIANT_ARRAY: {
-			uint32_t len = f->get_32();
+			uint32_t len = p_f->get_32();
 			Array a; //last bit means shared
 			len &= 0x7FFFFFFF;
 			a.resize(len);
 			for (uint32_t i = 0; i < len; i++) {
 				Variant val;
-				Error err = parse_variant(val);
+				Error err = _parse_variant(p_f, r_str_buf, val);
 				ERR_FAIL_COND_V_MSG(err, ERR_FILE_CORRUPT, "Error when trying to parse Variant.");
 				a[i] = val;
 			}
@@ -509,24 +516,24 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 
 		} break;
 		case VARIANT_PACKED_BYTE_ARRAY: {
-			uint32_t len = f->get_32();
+			uint32_t len = p_f->get_32();
 
 			Vector<uint8_t> array;
 			array.resize(len);
 			uint8_t *w = array.ptrw();
-			f->get_buffer(w, len);
-			_advance_padding(len);
+			p_f->get_buffer(w, len);
+			_advance_padding(p_f, len);
 
 			r_v = array;
 
 		} break;
 		case VARIANT_PACKED_INT32_ARRAY: {
-			uint32_t len = f->get_32();
+			uint32_t len = p_f->get_32();
 
 			Vector<int32_t> array;
 			array.resize(len);
 			int32_t *w = array.ptrw();
-			f->get_buffer((uint8_t *)w, len * sizeof(int32_t));
+			p_f->get_buffer((uint8_t *)w, len * sizeof(int32_t));
 #ifdef BIG_ENDIAN_ENABLED
 			{
 				uint32_t *ptr = (uint32_t *)w.ptr();
@@ -540,12 +547,12 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			r_v = array;
 		} break;
 		case VARIANT_PACKED_INT64_ARRAY: {
-			uint32_t len = f->get_32();
+			uint32_t len = p_f->get_32();
 
 			Vector<int64_t> array;
 			array.resize(len);
 			int64_t *w = array.ptrw();
-			f->get_buffer((uint8_t *)w, len * sizeof(int64_t));
+			p_f->get_buffer((uint8_t *)w, len * sizeof(int64_t));
 #ifdef BIG_ENDIAN_ENABLED
 			{
 				uint64_t *ptr = (uint64_t *)w.ptr();
@@ -559,12 +566,12 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			r_v = array;
 		} break;
 		case VARIANT_PACKED_FLOAT32_ARRAY: {
-			uint32_t len = f->get_32();
+			uint32_t len = p_f->get_32();
 
 			Vector<float> array;
 			array.resize(len);
 			float *w = array.ptrw();
-			f->get_buffer((uint8_t *)w, len * sizeof(float));
+			p_f->get_buffer((uint8_t *)w, len * sizeof(float));
 #ifdef BIG_ENDIAN_ENABLED
 			{
 				uint32_t *ptr = (uint32_t *)w.ptr();
@@ -578,12 +585,12 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			r_v = array;
 		} break;
 		case VARIANT_PACKED_FLOAT64_ARRAY: {
-			uint32_t len = f->get_32();
+			uint32_t len = p_f->get_32();
 
 			Vector<double> array;
 			array.resize(len);
 			double *w = array.ptrw();
-			f->get_buffer((uint8_t *)w, len * sizeof(double));
+			p_f->get_buffer((uint8_t *)w, len * sizeof(double));
 #ifdef BIG_ENDIAN_ENABLED
 			{
 				uint64_t *ptr = (uint64_t *)w.ptr();
@@ -597,52 +604,52 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			r_v = array;
 		} break;
 		case VARIANT_PACKED_STRING_ARRAY: {
-			uint32_t len = f->get_32();
+			uint32_t len = p_f->get_32();
 			Vector<String> array;
 			array.resize(len);
 			String *w = array.ptrw();
 			for (uint32_t i = 0; i < len; i++) {
-				w[i] = get_unicode_string();
+				w[i] = _get_unicode_string(p_f, r_str_buf);
 			}
 
 			r_v = array;
 
 		} break;
 		case VARIANT_PACKED_VECTOR2_ARRAY: {
-			uint32_t len = f->get_32();
+			uint32_t len = p_f->get_32();
 
 			Vector<Vector2> array;
 			array.resize(len);
 			Vector2 *w = array.ptrw();
 			static_assert(sizeof(Vector2) == 2 * sizeof(real_t));
-			const Error err = read_reals(reinterpret_cast<real_t *>(w), f, len * 2);
+			const Error err = read_reals(reinterpret_cast<real_t *>(w), p_f, len * 2);
 			ERR_FAIL_COND_V(err != OK, err);
 
 			r_v = array;
 
 		} break;
 		case VARIANT_PACKED_VECTOR3_ARRAY: {
-			uint32_t len = f->get_32();
+			uint32_t len = p_f->get_32();
 
 			Vector<Vector3> array;
 			array.resize(len);
 			Vector3 *w = array.ptrw();
 			static_assert(sizeof(Vector3) == 3 * sizeof(real_t));
-			const Error err = read_reals(reinterpret_cast<real_t *>(w), f, len * 3);
+			const Error err = read_reals(reinterpret_cast<real_t *>(w), p_f, len * 3);
 			ERR_FAIL_COND_V(err != OK, err);
 
 			r_v = array;
 
 		} break;
 		case VARIANT_PACKED_COLOR_ARRAY: {
-			uint32_t len = f->get_32();
+			uint32_t len = p_f->get_32();
 
 			Vector<Color> array;
 			array.resize(len);
 			Color *w = array.ptrw();
 			// Colors always use `float` even with double-precision support enabled
 			static_assert(sizeof(Color) == 4 * sizeof(float));
-			f->get_buffer((uint8_t *)w, len * sizeof(float) * 4);
+			p_f->get_buffer((uint8_t *)w, len * sizeof(float) * 4);
 #ifdef BIG_ENDIAN_ENABLED
 			{
 				uint32_t *ptr = (uint32_t *)w.ptr();
@@ -656,13 +663,13 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			r_v = array;
 		} break;
 		case VARIANT_PACKED_VECTOR4_ARRAY: {
-			uint32_t len = f->get_32();
+			uint32_t len = p_f->get_32();
 
 			Vector<Vector4> array;
 			array.resize(len);
 			Vector4 *w = array.ptrw();
 			static_assert(sizeof(Vector4) == 4 * sizeof(real_t));
-			const Error err = read_reals(reinterpret_cast<real_t *>(w), f, len * 4);
+			const Error err = read_reals(reinterpret_cast<real_t *>(w), p_f, len * 4);
 			ERR_FAIL_COND_V(err != OK, err);
 
 			r_v = array;
@@ -680,6 +687,163 @@ Ref<Resource> ResourceLoaderBinary::get_resource() {
 	return resource;
 }
 
+Error ResourceLoaderBinary::_parse_internal_properties(Ref<FileAccess> &p_f, Vector<char> &r_str_buf, InternalLoad &r_load) {
+	p_f->seek(r_load.properties_offset);
+
+	for (uint32_t j = 0; j < r_load.property_count; j++) {
+		StringName name = _get_string(p_f, r_str_buf);
+
+		if (name == StringName()) {
+			ERR_FAIL_V(ERR_FILE_CORRUPT);
+		}
+
+		Variant value;
+
+		Error err = _parse_variant(p_f, r_str_buf, value);
+		if (err) {
+			return err;
+		}
+
+		r_load.properties.push_back(Pair<StringName, Variant>(name, value));
+	}
+
+	return OK;
+}
+
+void ResourceLoaderBinary::_parse_internal_properties_task(uint32_t p_index, ThreadedParse *p_parse) {
+	InternalLoad &load = (*p_parse->loads)[p_parse->pending[p_index]];
+
+	Ref<FileAccessMemory> fm;
+	fm.instantiate();
+	fm->open_custom(p_parse->data, p_parse->length);
+	fm->set_big_endian(p_parse->big_endian);
+	fm->real_is_double = p_parse->real_is_double;
+
+	Ref<FileAccess> fa = fm;
+	Vector<char> task_str_buf;
+	load.error = _parse_internal_properties(fa, task_str_buf, load);
+}
+
+Error ResourceLoaderBinary::_parse_internal_properties_threaded(LocalVector<InternalLoad> &r_loads) {
+	// Wait for external resources up front, so the tasks only ever find them completed.
+	for (int i = 0; i < external_resources.size(); i++) {
+		Ref<ResourceLoader::LoadToken> &load_token = external_resources.write[i].load_token;
+		if (load_token.is_null()) {
+			continue;
+		}
+		Error err;
+		Ref<Resource> res = ResourceLoader::_load_complete(*load_token.ptr(), &err);
+		if (res.is_null() && !ResourceLoader::is_cleaning_tasks()) {
+			if (!ResourceLoader::get_abort_on_missing_resources()) {
+				ResourceLoader::notify_dependency_error(local_path, external_resources[i].path, external_resources[i].type);
+				load_token = Ref<ResourceLoader::LoadToken>(); // Accepted as broken, references will be null.
+			} else {
+				error = ERR_FILE_MISSING_DEPENDENCIES;
+				ERR_FAIL_V_MSG(error, "Can't load dependency: " + external_resources[i].path + ".");
+			}
+		}
+	}
+
+	ThreadedParse parse;
+	parse.loads = &r_loads;
+	parse.big_endian = f->is_big_endian();
+	parse.real_is_double = f->real_is_double;
+	for (uint32_t i = 0; i < r_loads.size(); i++) {
+		if (!r_loads[i].reused) {
+			parse.pending.push_back(i);
+		}
+	}
+
+	// Each task reads through its own view of the file.
+	Vector<uint8_t> file_data;
+	parse.data = f->get_mapped_buffer();
+	parse.length = f->get_length();
+	if (!parse.data) {
+		f->seek(0);
+		file_data = f->get_buffer(parse.length);
+		ERR_FAIL_COND_V((uint64_t)file_data.size() != parse.length, ERR_FILE_CORRUPT);
+		parse.data = file_data.ptr();
+	}
+
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_template_group_task(this, &ResourceLoaderBinary::_parse_internal_properties_task, &parse, parse.pending.size(), -1, true, SNAME("ResourceLoaderBinary::parse"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+	return OK;
+}
+
+bool ResourceLoaderBinary::_finish_internal_resource(int p_index, InternalLoad &p_load) {
+	bool main = p_index == (internal_resources.size() - 1);
+	Ref<Resource> res = p_load.res;
+	MissingResource *missing_resource = p_load.missing_resource;
+
+	//set properties
+
+	Dictionary missing_resource_properties;
+
+	for (Pair<StringName, Variant> &property : p_load.properties) {
+		const StringName &name = property.first;
+		Variant &value = property.second;
+
+		bool set_valid = true;
+		if (value.get_type() == Variant::OBJECT && missing_resource != nullptr) {
+			// If the property being set is a missing resource (and the parent is not),
+			// then setting it will most likely not work.
+			// Instead, save it as metadata.
+
+			Ref<MissingResource> mr = value;
+			if (mr.is_valid()) {
+				missing_resource_properties[name] = mr;
+				set_valid = false;
+			}
+		}
+
+		if (value.get_type() == Variant::ARRAY) {
+			Array set_array = value;
+			bool is_get_valid = false;
+			Variant get_value = res->get(name, &is_get_valid);
+			if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
+				Array get_array = get_value;
+				if (!set_array.is_same_typed(get_array)) {
+					value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
+				}
+			}
+		}
+
+		if (set_valid) {
+			res->set(name, value);
+		}
+	}
+	p_load.properties.clear();
+
+	if (missing_resource) {
+		missing_resource->set_recording_properties(false);
+	}
+
+	if (!missing_resource_properties.is_empty()) {
+		res->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
+	}
+
+#ifdef TOOLS_ENABLED
+	res->set_edited(false);
+#endif
+
+	if (progress) {
+		*progress = (p_index + 1) / float(internal_resources.size());
+	}
+
+	resource_cache.push_back(res);
+
+	if (main) {
+		f.unref();
+		resource = res;
+		resource->set_as_translation_remapped(translation_remapped);
+		error = OK;
+		return true;
+	}
+
+	return false;
+}
+
 Error ResourceLoaderBinary::load() {
 	if (error != OK) {
 		return error;
@@ -709,7 +873,19 @@ Error ResourceLoaderBinary::load() {
 		}
 	}
 
+	LocalVector<InternalLoad> loads;
+	loads.resize(internal_resources.size());
+
+	// With sub-threads, properties are decoded in parallel once every resource exists, and set in file order afterwards.
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	bool threaded = use_sub_threads && internal_resources.size() > 2 && pool && pool->get_thread_count() > 0;
+
 	for (int i = 0; i < internal_resources.size(); i++) {
+		if (ResourceLoader::is_load_cancelled()) {
+			error = ERR_SKIP;
+			return error;
+		}
+
 		bool main = i == (internal_resources.size() - 1);
 
 		//maybe it is loaded already
@@ -733,6 +909,7 @@ Error ResourceLoaderBinary::load() {
 					//already loaded, don't do anything
 					error = OK;
 					internal_index_cache[path] = cached;
+					loads[i].reused = true;
 					continue;
 				}
 			}
@@ -811,81 +988,38 @@ Error ResourceLoaderBinary::load() {
 			internal_index_cache[path] = res;
 		}
 
-		int pc = f->get_32();
-
-		//set properties
-
-		Dictionary missing_resource_properties;
+		loads[i].res = res;
+		loads[i].missing_resource = missing_resource;
+		loads[i].property_count = f->get_32();
+		loads[i].properties_offset = f->get_position();
 
-		for (int j = 0; j < pc; j++) {
-			StringName name = _get_string();
-
-			if (name == StringName()) {
-				error = ERR_FILE_CORRUPT;
-				ERR_FAIL_V(ERR_FILE_CORRUPT);
-			}
-
-			Variant value;
-
-			error = parse_variant(value);
+		if (!threaded) {
+			error = _parse_internal_properties(f, str_buf, loads[i]);
 			if (error) {
 				return error;
 			}
-
-			bool set_valid = true;
-			if (value.get_type() == Variant::OBJECT && missing_resource != nullptr) {
-				// If the property being set is a missing resource (and the parent is not),
-				// then setting it will most likely not work.
-				// Instead, save it as metadata.
-
-				Ref<MissingResource> mr = value;
-				if (mr.is_valid()) {
-					missing_resource_properties[name] = mr;
-					set_valid = false;
-				}
-			}
-
-			if (value.get_type() == Variant::ARRAY) {
-				Array set_array = value;
-				bool is_get_valid = false;
-				Variant get_value = res->get(name, &is_get_valid);
-				if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
-					Array get_array = get_value;
-					if (!set_array.is_same_typed(get_array)) {
-						value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
-					}
-				}
-			}
-
-			if (set_valid) {
-				res->set(name, value);
+			if (_finish_internal_resource(i, loads[i])) {
+				return OK;
 			}
 		}
+	}
 
-		if (missing_resource) {
-			missing_resource->set_recording_properties(false);
-		}
-
-		if (!missing_resource_properties.is_empty()) {
-			res->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
-		}
-
-#ifdef TOOLS_ENABLED
-		res->set_edited(false);
-#endif
-
-		if (progress) {
-			*progress = (i + 1) / float(internal_resources.size());
+	if (threaded) {
+		error = _parse_internal_properties_threaded(loads);
+		if (error) {
+			return error;
 		}
-
-		resource_cache.push_back(res);
-
-		if (main) {
-			f.unref();
-			resource = res;
-			resource->set_as_translation_remapped(translation_remapped);
-			error = OK;
-			return OK;
+		for (int i = 0; i < internal_resources.size(); i++) {
+			if (loads[i].reused) {
+				continue;
+			}
+			if (loads[i].error) {
+				error = loads[i].error;
+				return error;
+			}
+			if (_finish_internal_resource(i, loads[i])) {
+				return OK;
+			}
 		}
 	}
 
@@ -912,17 +1046,17 @@ static String get_ustring(Ref<FileAccess> f) {
 	return s;
 }
 
-String ResourceLoaderBinary::get_unicode_string() {
-	int len = f->get_32();
-	if (len > str_buf.size()) {
-		str_buf.resize(len);
+String ResourceLoaderBinary::_get_unicode_string(Ref<FileAccess> &p_f, Vector<char> &r_str_buf) {
+	int len = p_f->get_32();
+	if (len > r_str_buf.size()) {
+		r_str_buf.resize(len);
 	}
 	if (len == 0) {
 		return String();
 	}
-	f->get_buffer((uint8_t *)&str_buf[0], len);
+	p_f->get_buffer((uint8_t *)&r_str_buf[0], len);
 	String s;
-	s.parse_utf8(&str_buf[0]);
+	s.parse_utf8(&r_str_buf[0]);
 	return s;
 }
 
@@ -34,6 +34,10 @@
 #include "core/io/file_access.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/pair.h"
+
+class MissingResource;
 
 class ResourceLoaderBinary {
 	bool translation_remapped = false;
@@ -54,7 +58,8 @@ class ResourceLoaderBinary {
 
 	Vector<StringName> string_map;
 
-	StringName _get_string();
+	StringName _get_string() { return _get_string(f, str_buf); }
+	StringName _get_string(Ref<FileAccess> &p_f, Vector<char> &r_str_buf) const;
 
 	struct ExtResource {
 		String path;
@@ -78,8 +83,9 @@ class ResourceLoaderBinary {
 	Vector<IntResource> internal_resources;
 	HashMap<String, Ref<Resource>> internal_index_cache;
 
-	String get_unicode_string();
-	void _advance_padding(uint32_t p_len);
+	String get_unicode_string() { return _get_unicode_string(f, str_buf); }
+	static String _get_unicode_string(Ref<FileAccess> &p_f, Vector<char> &r_str_buf);
+	static void _advance_padding(Ref<FileAccess> &p_f, uint32_t p_len);
 
 	HashMap<String, String> remaps;
 	Error error = OK;
@@ -90,6 +96,31 @@ class ResourceLoaderBinary {
 	friend class ResourceFormatLoaderBinary;
 
 	Error parse_variant(Variant &r_v);
+	Error _parse_variant(Ref<FileAccess> &p_f, Vector<char> &r_str_buf, Variant &r_v);
+
+	struct InternalLoad {
+		Ref<Resource> res;
+		MissingResource *missing_resource = nullptr;
+		uint64_t properties_offset = 0;
+		uint32_t property_count = 0;
+		LocalVector<Pair<StringName, Variant>> properties;
+		Error error = OK;
+		bool reused = false; // Already in the cache, nothing to set.
+	};
+
+	struct ThreadedParse {
+		LocalVector<InternalLoad> *loads = nullptr;
+		LocalVector<uint32_t> pending;
+		const uint8_t *data = nullptr;
+		uint64_t length = 0;
+		bool big_endian = false;
+		bool real_is_double = false;
+	};
+
+	Error _parse_internal_properties(Ref<FileAccess> &p_f, Vector<char> &r_str_buf, InternalLoad &r_load);
+	void _parse_internal_properties_task(uint32_t p_index, ThreadedParse *p_parse);
+	Error _parse_internal_properties_threaded(LocalVector<InternalLoad> &r_loads);
+	bool _finish_internal_resource(int p_index, InternalLoad &p_load);
 
 	HashMap<String, Ref<Resource>> dependency_cache;
 
@@ -220,6 +220,9 @@ void ResourceLoader::LoadToken::clear() {
 			task_to_await = load_task.task_id;
 			load_task.awaited = true;
 		}
+		if (load_task.cancelled) {
+			cancelled_load_count.decrement();
+		}
 		thread_load_tasks.erase(local_path);
 		local_path.clear();
 	}
@@ -320,12 +323,39 @@ void ResourceLoader::_thread_load_function(void *p_userdata) {
 	// --
 
 	Error load_err = OK;
-	Ref<Resource> res = _load(load_task.remapped_path, load_task.remapped_path != load_task.local_path ? load_task.local_path : String(), load_task.type_hint, load_task.cache_mode, &load_err, load_task.use_sub_threads, &load_task.progress);
-	if (MessageQueue::get_singleton() != MessageQueue::get_main_singleton()) {
-		MessageQueue::get_singleton()->flush();
-	}
+	Ref<Resource> res;
+	while (true) {
+		thread_load_mutex.lock();
+		bool cancelled = load_task.cancelled;
+		load_task.cancel_seen = cancelled;
+		thread_load_mutex.unlock();
 
-	thread_load_mutex.lock();
+		if (cancelled) {
+			load_err = ERR_SKIP;
+		} else {
+			if (load_task.prefetch_dependencies) {
+				load_task.prefetch_dependencies = false;
+				HashSet<String> visited;
+				Vector<uint8_t> buffer;
+				buffer.resize(65536);
+				_prefetch_dependencies(load_task.local_path, visited, buffer);
+			}
+			res = _load(load_task.remapped_path, load_task.remapped_path != load_task.local_path ? load_task.local_path : String(), load_task.type_hint, load_task.cache_mode, &load_err, load_task.use_sub_threads, &load_task.progress);
+		}
+		if (MessageQueue::get_singleton() != MessageQueue::get_main_singleton()) {
+			MessageQueue::get_singleton()->flush();
+		}
+
+		thread_load_mutex.lock();
+		if (load_task.cancel_seen && !load_task.cancelled) {
+			// Requested again while giving up. Start over, since what was loaded so far is incomplete.
+			thread_load_mutex.unlock();
+			res = Ref<Resource>();
+			load_err = OK;
+			continue;
+		}
+		break;
+	}
 
 	load_task.resource = res;
 
@@ -430,18 +460,25 @@ Error ResourceLoader::load_threaded_request(const String &p_path, const String &
 	thread_load_mutex.lock();
 	if (user_load_tokens.has(p_path)) {
 		print_verbose("load_threaded_request(): Another threaded load for resource path '" + p_path + "' has been initiated. Not an error.");
-		user_load_tokens[p_path]->reference(); // Additional request.
+		LoadToken *load_token = user_load_tokens[p_path];
+		if (load_token) {
+			load_token->reference(); // Additional request.
+			load_token->user_rc++;
+		}
 		thread_load_mutex.unlock();
 		return OK;
 	}
 	user_load_tokens[p_path] = nullptr;
 	thread_load_mutex.unlock();
 
+	_release_cancelled_load_tokens();
+
 	Ref<ResourceLoader::LoadToken> token = _load_start(p_path, p_type_hint, p_use_sub_threads ? LOAD_THREAD_DISTRIBUTE : LOAD_THREAD_SPAWN_SINGLE, p_cache_mode);
 	if (token.is_valid()) {
 		thread_load_mutex.lock();
 		token->user_path = p_path;
 		token->reference(); // First request.
+		token->user_rc++;
 		user_load_tokens[p_path] = token.ptr();
 		print_lt("REQUEST: user load tokens: " + itos(user_load_tokens.size()));
 		thread_load_mutex.unlock();
@@ -481,6 +518,19 @@ Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path,
 	{
 		MutexLock thread_load_lock(thread_load_mutex);
 
+		if (!ignoring_cache && thread_load_tasks.has(local_path)) {
+			ThreadLoadTask &existing_task = thread_load_tasks[local_path];
+			if (existing_task.cancelled) {
+				// Requested again after being cancelled. If the load is still running, let it go on;
+				// otherwise, it gave up already, so drop the task and start a new one.
+				existing_task.cancelled = false;
+				cancelled_load_count.decrement();
+				if (existing_task.status != THREAD_LOAD_IN_PROGRESS && existing_task.cancel_seen) {
+					existing_task.load_token->clear();
+				}
+			}
+		}
+
 		if (!ignoring_cache && thread_load_tasks.has(local_path)) {
 			load_token = Ref<LoadToken>(thread_load_tasks[local_path].load_token);
 			if (load_token.is_valid()) {
@@ -505,6 +555,18 @@ Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path,
 			load_task.type_hint = p_type_hint;
 			load_task.cache_mode = p_cache_mode;
 			load_task.use_sub_threads = p_thread_mode == LOAD_THREAD_DISTRIBUTE;
+			if (load_paths_stack && load_paths_stack->size()) {
+				// Dependencies are as urgent as the resource needing them.
+				ThreadLoadTask *parent_task = thread_load_tasks.getptr(load_paths_stack->get(load_paths_stack->size() - 1));
+				if (parent_task) {
+					load_task.priority = parent_task->priority;
+					if (p_thread_mode != LOAD_THREAD_FROM_CURRENT) {
+						parent_task->sub_tasks.insert(local_path);
+					}
+				}
+			} else {
+				load_task.prefetch_dependencies = prefetch_dependencies && p_thread_mode != LOAD_THREAD_FROM_CURRENT;
+			}
 			if (p_cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE) {
 				Ref<Resource> existing = ResourceCache::get_ref(local_path);
 				if (existing.is_valid()) {
@@ -536,6 +598,9 @@ Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path,
 			load_task_ptr->thread_id = Thread::get_caller_id();
 		} else {
 			load_task_ptr->task_id = WorkerThreadPool::get_singleton()->add_native_task(&ResourceLoader::_thread_load_function, load_task_ptr);
+			if (load_task_ptr->priority != 0) {
+				WorkerThreadPool::get_singleton()->set_task_priority(load_task_ptr->task_id, load_task_ptr->priority);
+			}
 		}
 	}
 
@@ -656,19 +721,175 @@ Ref<Resource> ResourceLoader::load_threaded_get(const String &p_path, Error *r_e
 		}
 
 		res = _load_complete_inner(*load_token, r_error, thread_load_lock);
+		load_token->user_rc--;
 		if (load_token->unreference()) {
 			memdelete(load_token);
 		}
 	}
 
+	// Not under the lock, since it may evict (and free) other resources.
+	ResourceCache::retain(res);
+
 	print_lt("GET: user load tokens: " + itos(user_load_tokens.size()));
 
 	return res;
 }
 
-Ref<Resource> ResourceLoader::_load_complete(LoadToken &p_load_token, Error *r_error) {
+Error ResourceLoader::load_threaded_set_priority(const String &p_path, int p_priority) {
 	MutexLock thread_load_lock(thread_load_mutex);
-	return _load_complete_inner(p_load_token, r_error, thread_load_lock);
+
+	if (!user_load_tokens.has(p_path)) {
+		print_verbose("load_threaded_set_priority(): No threaded load for resource path '" + p_path + "' has been initiated or its result has already been collected.");
+		return ERR_INVALID_PARAMETER;
+	}
+
+	LoadToken *load_token = user_load_tokens[p_path];
+	if (!load_token) {
+		return ERR_BUSY;
+	}
+
+	if (!load_token->local_path.is_empty()) {
+		_set_load_priority(load_token->local_path, p_priority, true);
+	}
+	return OK;
+}
+
+void ResourceLoader::_set_load_priority(const String &p_local_path, int p_priority, bool p_force) {
+	ThreadLoadTask *load_task = thread_load_tasks.getptr(p_local_path);
+	if (!load_task || load_task->status != THREAD_LOAD_IN_PROGRESS) {
+		return;
+	}
+	// Dependencies may be shared with more urgent loads, so they are only ever raised.
+	if (!p_force && load_task->priority >= p_priority) {
+		return;
+	}
+
+	load_task->priority = p_priority;
+	if (load_task->task_id) {
+		WorkerThreadPool::get_singleton()->set_task_priority(load_task->task_id, p_priority);
+	}
+	for (const String &E : load_task->sub_tasks) {
+		_set_load_priority(E, p_priority, false);
+	}
+}
+
+Error ResourceLoader::load_threaded_cancel(const String &p_path) {
+	{
+		MutexLock thread_load_lock(thread_load_mutex);
+
+		if (!user_load_tokens.has(p_path)) {
+			print_verbose("load_threaded_cancel(): No threaded load for resource path '" + p_path + "' has been initiated or its result has already been collected.");
+			return ERR_INVALID_PARAMETER;
+		}
+
+		LoadToken *load_token = user_load_tokens[p_path];
+		if (!load_token) {
+			return ERR_BUSY;
+		}
+
+		user_load_tokens.erase(p_path);
+		load_token->user_path.clear();
+
+		ThreadLoadTask *load_task = load_token->local_path.is_empty() ? nullptr : thread_load_tasks.getptr(load_token->local_path);
+		// Only stop the load if nothing but user requests is waiting for it; other loads may depend on it.
+		if (load_task && load_task->status == THREAD_LOAD_IN_PROGRESS && !load_task->cancelled && load_token->get_reference_count() == (int)load_token->user_rc) {
+			load_task->cancelled = true;
+			cancelled_load_count.increment();
+		}
+
+		// Keep a single reference until the load stops, so the task isn't awaited from here.
+		for (; load_token->user_rc > 1; load_token->user_rc--) {
+			load_token->unreference();
+		}
+		load_token->user_rc = 0;
+		cancelled_load_tokens.push_back(load_token);
+	}
+
+	_release_cancelled_load_tokens();
+	return OK;
+}
+
+void ResourceLoader::_release_cancelled_load_tokens() {
+	LocalVector<LoadToken *> tokens_to_release;
+	{
+		MutexLock thread_load_lock(thread_load_mutex);
+		for (uint32_t i = 0; i < cancelled_load_tokens.size();) {
+			LoadToken *load_token = cancelled_load_tokens[i];
+			const ThreadLoadTask *load_task = load_token->local_path.is_empty() ? nullptr : thread_load_tasks.getptr(load_token->local_path);
+			if (load_task && load_task->status == THREAD_LOAD_IN_PROGRESS) {
+				i++;
+				continue;
+			}
+			tokens_to_release.push_back(load_token);
+			cancelled_load_tokens.remove_at_unordered(i);
+		}
+	}
+
+	for (LoadToken *load_token : tokens_to_release) {
+		if (load_token->unreference()) {
+			memdelete(load_token);
+		}
+	}
+}
+
+bool ResourceLoader::is_load_cancelled() {
+	if (cancelled_load_count.get() == 0 || !load_paths_stack) {
+		return false;
+	}
+
+	if (load_paths_stack->is_empty()) {
+		return false;
+	}
+
+	// Only the innermost load counts. Outer ones may be cancelled while this one is a dependency
+	// other loads are waiting for; they will stop once it returns.
+	MutexLock thread_load_lock(thread_load_mutex);
+	ThreadLoadTask *load_task = thread_load_tasks.getptr(load_paths_stack->get(load_paths_stack->size() - 1));
+	if (load_task && load_task->cancelled) {
+		load_task->cancel_seen = true;
+		return true;
+	}
+	return false;
+}
+
+void ResourceLoader::_prefetch_dependencies(const String &p_path, HashSet<String> &r_visited, Vector<uint8_t> &r_buffer) {
+	if (r_visited.has(p_path)) {
+		return;
+	}
+	r_visited.insert(p_path);
+
+	// Reading the file through gets it into the OS cache before the loader needs it.
+	Ref<FileAccess> f = FileAccess::open(import_remap(_path_remap(p_path)), FileAccess::READ);
+	if (f.is_valid()) {
+		while (f->get_buffer(r_buffer.ptrw(), r_buffer.size()) == (uint64_t)r_buffer.size()) {
+		}
+	}
+
+	List<String> dependencies;
+	get_dependencies(p_path, &dependencies);
+	for (const String &E : dependencies) {
+		// Dependencies may come as "uid::type::path", with the type optional.
+		String dependency = E.get_slice("::", 0);
+		ResourceUID::ID uid = ResourceUID::get_singleton()->text_to_id(dependency);
+		if (uid != ResourceUID::INVALID_ID) {
+			dependency = ResourceUID::get_singleton()->has_id(uid) ? ResourceUID::get_singleton()->get_id_path(uid) : E.get_slice("::", 2);
+		}
+		if (dependency.is_empty() || ResourceCache::has(dependency)) {
+			continue;
+		}
+		_prefetch_dependencies(dependency, r_visited, r_buffer);
+	}
+}
+
+Ref<Resource> ResourceLoader::_load_complete(LoadToken &p_load_token, Error *r_error) {
+	Ref<Resource> resource;
+	{
+		MutexLock thread_load_lock(thread_load_mutex);
+		resource = _load_complete_inner(p_load_token, r_error, thread_load_lock);
+	}
+	// Not under the lock, since it may evict (and free) other resources.
+	ResourceCache::retain(resource);
+	return resource;
 }
 
 Ref<Resource> ResourceLoader::_load_complete_inner(LoadToken &p_load_token, Error *r_error, MutexLock<SafeBinaryMutex<BINARY_MUTEX_TAG>> &p_thread_load_lock) {
@@ -1186,6 +1407,12 @@ void ResourceLoader::clear_thread_load_tasks() {
 		thread_load_mutex.lock();
 	}
 
+	for (LoadToken *load_token : cancelled_load_tokens) {
+		memdelete(load_token);
+	}
+	cancelled_load_tokens.clear();
+	cancelled_load_count.set(0);
+
 	while (user_load_tokens.begin()) {
 		// User load tokens remove themselves from the map on destruction.
 		memdelete(user_load_tokens.begin()->value);
@@ -1306,6 +1533,7 @@ DependencyErrorNotify ResourceLoader::dep_err_notify = nullptr;
 bool ResourceLoader::create_missing_resources_if_class_unavailable = false;
 bool ResourceLoader::abort_on_missing_resource = true;
 bool ResourceLoader::timestamp_on_load = false;
+bool ResourceLoader::prefetch_dependencies = false;
 
 thread_local int ResourceLoader::load_nesting = 0;
 thread_local WorkerThreadPool::TaskID ResourceLoader::caller_task_id = 0;
@@ -1319,6 +1547,8 @@ HashMap<String, ResourceLoader::ThreadLoadTask> ResourceLoader::thread_load_task
 bool ResourceLoader::cleaning_tasks = false;
 
 HashMap<String, ResourceLoader::LoadToken *> ResourceLoader::user_load_tokens;
+LocalVector<ResourceLoader::LoadToken *> ResourceLoader::cancelled_load_tokens;
+SafeNumeric<uint32_t> ResourceLoader::cancelled_load_count;
 
 SelfList<Resource>::List ResourceLoader::remapped_list;
 HashMap<String, Vector<String>> ResourceLoader::translation_remaps;
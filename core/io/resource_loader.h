@@ -121,6 +121,7 @@ public:
 	struct LoadToken : public RefCounted {
 		String local_path;
 		String user_path;
+		uint32_t user_rc = 0; // References held on behalf of load_threaded_request() calls.
 		Ref<Resource> res_if_unregistered;
 
 		void clear();
@@ -139,6 +140,7 @@ private:
 	static Ref<ResourceFormatLoader> loader[MAX_LOADERS];
 	static int loader_count;
 	static bool timestamp_on_load;
+	static bool prefetch_dependencies;
 
 	static void *err_notify_ud;
 	static ResourceLoadErrorNotify err_notify;
@@ -180,6 +182,10 @@ private:
 		Ref<Resource> resource;
 		bool xl_remapped = false;
 		bool use_sub_threads = false;
+		bool prefetch_dependencies = false;
+		int priority = 0;
+		bool cancelled = false;
+		bool cancel_seen = false; // A loader gave up because of the cancellation.
 		HashSet<String> sub_tasks;
 	};
 
@@ -194,6 +200,12 @@ private:
 	static bool cleaning_tasks;
 
 	static HashMap<String, LoadToken *> user_load_tokens;
+	static LocalVector<LoadToken *> cancelled_load_tokens; // Released once their loads stop.
+	static SafeNumeric<uint32_t> cancelled_load_count;
+
+	static void _set_load_priority(const String &p_local_path, int p_priority, bool p_force);
+	static void _release_cancelled_load_tokens();
+	static void _prefetch_dependencies(const String &p_path, HashSet<String> &r_visited, Vector<uint8_t> &r_buffer);
 
 	static float _dependency_get_progress(const String &p_path);
 
@@ -203,6 +215,11 @@ public:
 	static Error load_threaded_request(const String &p_path, const String &p_type_hint = "", bool p_use_sub_threads = false, ResourceFormatLoader::CacheMode p_cache_mode = ResourceFormatLoader::CACHE_MODE_REUSE);
 	static ThreadLoadStatus load_threaded_get_status(const String &p_path, float *r_progress = nullptr);
 	static Ref<Resource> load_threaded_get(const String &p_path, Error *r_error = nullptr);
+	static Error load_threaded_set_priority(const String &p_path, int p_priority);
+	static Error load_threaded_cancel(const String &p_path);
+
+	// Loaders can call this between steps to give up early on loads nobody waits for anymore.
+	static bool is_load_cancelled();
 
 	static bool is_within_load() { return load_nesting > 0; };
 
@@ -226,6 +243,9 @@ public:
 	static void set_timestamp_on_load(bool p_timestamp) { timestamp_on_load = p_timestamp; }
 	static bool get_timestamp_on_load() { return timestamp_on_load; }
 
+	static void set_prefetch_dependencies(bool p_prefetch) { prefetch_dependencies = p_prefetch; }
+	static bool get_prefetch_dependencies() { return prefetch_dependencies; }
+
 	// Loaders can safely use this regardless which thread they are running on.
 	static void notify_load_error(const String &p_err) {
 		if (err_notify) {
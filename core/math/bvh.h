@@ -52,6 +52,7 @@
 // and pairable_mask is either 0 if static, or set to all if non static
 
 #include "bvh_tree.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/mutex.h"
 
 #define BVHTREE_CLASS BVH_Tree<T, NUM_TREES, 2, MAX_ITEMS, USER_PAIR_TEST_FUNCTION, USER_CULL_TEST_FUNCTION, USE_PAIRS, BOUNDS, POINT>
@@ -71,6 +72,21 @@ public:
 		_thread_safe = p_enable;
 	}
 
+	// When enabled, the broadphase culls of the items changed this tick run in parallel on the
+	// WorkerThreadPool before pairing. Pair and unpair callbacks are still sent from the calling
+	// thread, in the same order as the serial path.
+	void params_set_parallel_pairing(bool p_enable) {
+		BVH_LOCKED_FUNCTION
+		_parallel_pairing = p_enable;
+	}
+
+#ifdef TESTS_ENABLED
+	// Number of pairing passes that went through the parallel path.
+	uint32_t get_parallel_pairing_pass_count() const {
+		return _parallel_pairing_passes;
+	}
+#endif
+
 	// these 2 are crucial for fine tuning, and can be applied manually
 	// see the variable declarations for more info.
 	void params_set_node_expansion(real_t p_value) {
@@ -444,7 +460,23 @@ private:
 		params.result_array = nullptr;
 		params.subindex_array = nullptr;
 
-		for (const BVHHandle &h : changed_items) {
+		// Pairing only changes the pair lists, never the tree, so the culls of all changed items
+		// can be done up front in parallel and give the same hits as culling one by one.
+		bool parallel = _parallel_pairing && changed_items.size() >= PARALLEL_PAIRING_MIN_ITEMS && WorkerThreadPool::get_singleton();
+		if (parallel) {
+			if (_changed_item_hits.size() < changed_items.size()) {
+				_changed_item_hits.resize(changed_items.size());
+			}
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &BVH_Manager::_cull_changed_item, (void *)nullptr, changed_items.size(), -1, true, SNAME("BVHPairing"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+#ifdef TESTS_ENABLED
+			_parallel_pairing_passes++;
+#endif
+		}
+
+		for (uint32_t n = 0; n < changed_items.size(); n++) {
+			const BVHHandle &h = changed_items[n];
+
 			// use the expanded aabb for pairing
 			const BOUNDS &expanded_aabb = tree._pairs[h.id()].expanded_aabb;
 			BVHABB_CLASS abb;
@@ -458,12 +490,14 @@ private:
 
 			uint32_t changed_item_ref_id = h.id();
 
-			params.abb = abb;
+			if (!parallel) {
+				params.abb = abb;
 
-			params.result_count_overall = 0; // might not be needed
-			tree.cull_aabb(params, false);
+				params.result_count_overall = 0; // might not be needed
+				tree.cull_aabb(params, false);
+			}
 
-			for (const uint32_t ref_id : tree._cull_hits) {
+			for (const uint32_t ref_id : (parallel ? _changed_item_hits[n] : tree._cull_hits)) {
 				// don't collide against ourself
 				if (ref_id == changed_item_ref_id) {
 					continue;
@@ -480,6 +514,22 @@ private:
 		_reset();
 	}
 
+	void _cull_changed_item(uint32_t p_index, void *p_userdata) {
+		const BVHHandle &h = changed_items[p_index];
+
+		typename BVHTREE_CLASS::CullParams params;
+		params.result_count_overall = 0;
+		params.result_max = INT_MAX;
+		params.result_array = nullptr;
+		params.subindex_array = nullptr;
+		params.hits = &_changed_item_hits[p_index];
+
+		tree.item_fill_cullparams(h, params);
+		params.abb.from(tree._pairs[h.id()].expanded_aabb);
+
+		tree.cull_aabb(params, false);
+	}
+
 public:
 	void item_get_AABB(BVHHandle p_handle, BOUNDS &r_aabb) {
 		DEV_ASSERT(!p_handle.is_invalid());
@@ -773,6 +823,15 @@ private:
 	LocalVector<BVHHandle, uint32_t, true> changed_items;
 	uint32_t _tick = 1; // Start from 1 so items with 0 indicate never updated.
 
+	// Below this many changed items, pairing stays on the calling thread.
+	static const uint32_t PARALLEL_PAIRING_MIN_ITEMS = 128;
+	bool _parallel_pairing = false;
+#ifdef TESTS_ENABLED
+	uint32_t _parallel_pairing_passes = 0;
+#endif
+	// Cull hits of each changed item when pairing in parallel, kept between ticks to reuse the allocations.
+	LocalVector<LocalVector<uint32_t, uint32_t, true>> _changed_item_hits;
+
 	class BVHLockedFunction {
 	public:
 		BVHLockedFunction(Mutex *p_mutex, bool p_thread_safe) {
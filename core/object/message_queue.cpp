@@ -58,12 +58,46 @@
 		mutex.unlock();                           \
 	}
 
-void CallQueue::_add_page() {
-	if (pages_used == page_bytes.size()) {
-		pages.push_back(allocator->alloc());
-		page_bytes.push_back(0);
+CallQueue::Page *CallQueue::_alloc_page() {
+	MutexLock lock(spare_pages_mutex);
+	if (spare_pages.is_empty()) {
+		pages_allocated.increment();
+		return allocator->alloc();
+	}
+	Page *page = spare_pages[spare_pages.size() - 1];
+	spare_pages.resize(spare_pages.size() - 1);
+	return page;
+}
+
+void CallQueue::_free_page(Page *p_page) {
+	MutexLock lock(spare_pages_mutex);
+	spare_pages.push_back(p_page);
+}
+
+bool CallQueue::_reserve_page() {
+	// Shared with the threads pushing to their own buffers.
+	if (pages_in_use.increment() > max_pages) {
+		pages_in_use.decrement();
+		return false;
+	}
+	return true;
+}
+
+void CallQueue::_release_pages() {
+	// The queue must be locked. Keeps the first page, which is always in use.
+	for (uint32_t i = 1; i < pages_used; i++) {
+		_free_page(pages[i]);
 	}
-	page_bytes[pages_used] = 0;
+	pages_in_use.sub(pages_used - 1);
+	pages.resize(1);
+	page_bytes.resize(1);
+	page_bytes[0] = 0;
+	pages_used = 1;
+}
+
+void CallQueue::_add_page() {
+	pages.push_back(_alloc_page());
+	page_bytes.push_back(0);
 	pages_used++;
 }
 
@@ -83,30 +117,101 @@ Error CallQueue::push_set(Object *p_object, const StringName &p_prop, const Vari
 	return push_set(p_object->get_instance_id(), p_prop, p_value);
 }
 
-Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error) {
-	uint32_t room_needed = sizeof(Message) + sizeof(Variant) * p_argcount;
+CallQueue::ThreadBufferOwner::~ThreadBufferOwner() {
+	if (!buffer || queue != MessageQueue::main_singleton) {
+		return;
+	}
 
-	ERR_FAIL_COND_V_MSG(room_needed > uint32_t(PAGE_SIZE_BYTES), ERR_INVALID_PARAMETER, "Message is too large to fit on a page (" + itos(PAGE_SIZE_BYTES) + " bytes), consider passing less arguments.");
+	MutexLock queue_lock(queue->mutex);
+	bool free_buffer = false;
+	{
+		MutexLock lock(buffer->mutex);
+		// With pending messages, the buffer stays registered so they are still flushed; the queue frees it afterwards.
+		buffer->thread_exited = true;
+		free_buffer = buffer->messages == 0;
+	}
+	if (free_buffer) {
+		queue->thread_buffers.erase(buffer);
+		memdelete(buffer);
+	}
+}
 
-	LOCK_MUTEX;
+CallQueue::ThreadBuffer *CallQueue::_get_thread_buffer() {
+	if (!use_thread_buffers || Thread::is_main_thread() || this == MessageQueue::thread_singleton) {
+		return nullptr;
+	}
+	if (likely(thread_buffer_owner.queue == this)) {
+		return thread_buffer_owner.buffer;
+	}
 
-	_ensure_first_page();
+	ThreadBuffer *buffer = memnew(ThreadBuffer);
+	mutex.lock();
+	thread_buffers.push_back(buffer);
+	mutex.unlock();
 
-	if ((page_bytes[pages_used - 1] + room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
-		if (pages_used == max_pages) {
-			fprintf(stderr, "Failed method: %s. Message queue out of memory. %s\n", String(p_callable).utf8().get_data(), error_text.utf8().get_data());
-			statistics();
-			UNLOCK_MUTEX;
-			return ERR_OUT_OF_MEMORY;
+	thread_buffer_owner.queue = this;
+	thread_buffer_owner.buffer = buffer;
+	return buffer;
+}
+
+uint8_t *CallQueue::_thread_buffer_reserve(ThreadBuffer *p_buffer, uint32_t p_room_needed) {
+	// The buffer must be locked.
+	if (p_buffer->pages.is_empty() || p_buffer->page_bytes[p_buffer->pages.size() - 1] + p_room_needed > uint32_t(PAGE_SIZE_BYTES)) {
+		if (!_reserve_page()) {
+			return nullptr;
 		}
-		_add_page();
+		p_buffer->pages.push_back(_alloc_page());
+		p_buffer->page_bytes.push_back(0);
 	}
 
-	Page *page = pages[pages_used - 1];
+	uint32_t last = p_buffer->pages.size() - 1;
+	uint8_t *buffer_end = &p_buffer->pages[last]->data[p_buffer->page_bytes[last]];
+	p_buffer->page_bytes[last] += p_room_needed;
+	p_buffer->messages++;
+	thread_buffer_messages.increment();
+	return buffer_end;
+}
 
-	uint8_t *buffer_end = &page->data[page_bytes[pages_used - 1]];
+void CallQueue::_link_thread_buffers() {
+	// The queue must be locked. Pages are moved as they are, messages don't need to be relocated.
+	_ensure_first_page();
 
-	Message *msg = memnew_placement(buffer_end, Message);
+	for (uint32_t i = 0; i < thread_buffers.size(); i++) {
+		ThreadBuffer *buffer = thread_buffers[i];
+		bool free_buffer = false;
+		{
+			MutexLock lock(buffer->mutex);
+			if (buffer->messages) {
+				if (pages_used && page_bytes[pages_used - 1] == 0) {
+					// Don't leave an empty page in the middle, it would end the flush early.
+					pages_used--;
+					_free_page(pages[pages_used]);
+					pages.resize(pages_used);
+					page_bytes.resize(pages_used);
+					pages_in_use.decrement();
+				}
+				for (uint32_t j = 0; j < buffer->pages.size(); j++) {
+					pages.push_back(buffer->pages[j]);
+					page_bytes.push_back(buffer->page_bytes[j]);
+					pages_used++;
+				}
+				buffer->pages.clear();
+				buffer->page_bytes.clear();
+				thread_buffer_messages.sub(buffer->messages);
+				buffer->messages = 0;
+			}
+			free_buffer = buffer->thread_exited;
+		}
+		if (free_buffer) {
+			memdelete(buffer);
+			thread_buffers.remove_at_unordered(i);
+			i--;
+		}
+	}
+}
+
+void CallQueue::_write_call(uint8_t *p_buffer, const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error) {
+	Message *msg = memnew_placement(p_buffer, Message);
 	msg->args = p_argcount;
 	msg->callable = p_callable;
 	msg->type = TYPE_CALL;
@@ -118,13 +223,75 @@ Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_ar
 		msg->type |= FLAG_NULL_IS_OK;
 	}
 
-	buffer_end += sizeof(Message);
+	p_buffer += sizeof(Message);
 
 	for (int i = 0; i < p_argcount; i++) {
-		Variant *v = memnew_placement(buffer_end, Variant);
-		buffer_end += sizeof(Variant);
+		Variant *v = memnew_placement(p_buffer, Variant);
+		p_buffer += sizeof(Variant);
 		*v = *p_args[i];
 	}
+}
+
+void CallQueue::_write_set(uint8_t *p_buffer, ObjectID p_id, const StringName &p_prop, const Variant &p_value) {
+	Message *msg = memnew_placement(p_buffer, Message);
+	msg->args = 1;
+	msg->callable = Callable(p_id, p_prop);
+	msg->type = TYPE_SET;
+
+	p_buffer += sizeof(Message);
+
+	Variant *v = memnew_placement(p_buffer, Variant);
+	*v = p_value;
+}
+
+void CallQueue::_write_notification(uint8_t *p_buffer, ObjectID p_id, int p_notification) {
+	Message *msg = memnew_placement(p_buffer, Message);
+
+	msg->type = TYPE_NOTIFICATION;
+	msg->callable = Callable(p_id, CoreStringName(notification)); //name is meaningless but callable needs it
+	//msg->target;
+	msg->notification = p_notification;
+}
+
+Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error) {
+	uint32_t room_needed = sizeof(Message) + sizeof(Variant) * p_argcount;
+
+	ERR_FAIL_COND_V_MSG(room_needed > uint32_t(PAGE_SIZE_BYTES), ERR_INVALID_PARAMETER, "Message is too large to fit on a page (" + itos(PAGE_SIZE_BYTES) + " bytes), consider passing less arguments.");
+
+	if (ThreadBuffer *thread_buffer = _get_thread_buffer()) {
+		MutexLock lock(thread_buffer->mutex);
+		uint8_t *buffer_end = _thread_buffer_reserve(thread_buffer, room_needed);
+		if (!buffer_end) {
+			fprintf(stderr, "Failed method: %s. Message queue out of memory. %s\n", String(p_callable).utf8().get_data(), error_text.utf8().get_data());
+			return ERR_OUT_OF_MEMORY;
+		}
+		_write_call(buffer_end, p_callable, p_args, p_argcount, p_show_error);
+		return OK;
+	}
+
+	LOCK_MUTEX;
+
+	if (thread_buffer_messages.get()) {
+		_link_thread_buffers();
+	}
+
+	_ensure_first_page();
+
+	if ((page_bytes[pages_used - 1] + room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
+		if (!_reserve_page()) {
+			fprintf(stderr, "Failed method: %s. Message queue out of memory. %s\n", String(p_callable).utf8().get_data(), error_text.utf8().get_data());
+			statistics();
+			UNLOCK_MUTEX;
+			return ERR_OUT_OF_MEMORY;
+		}
+		_add_page();
+	}
+
+	Page *page = pages[pages_used - 1];
+
+	uint8_t *buffer_end = &page->data[page_bytes[pages_used - 1]];
+
+	_write_call(buffer_end, p_callable, p_args, p_argcount, p_show_error);
 
 	page_bytes[pages_used - 1] += room_needed;
 
@@ -134,13 +301,29 @@ Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_ar
 }
 
 Error CallQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant &p_value) {
-	LOCK_MUTEX;
 	uint32_t room_needed = sizeof(Message) + sizeof(Variant);
 
+	if (ThreadBuffer *thread_buffer = _get_thread_buffer()) {
+		MutexLock lock(thread_buffer->mutex);
+		uint8_t *buffer_end = _thread_buffer_reserve(thread_buffer, room_needed);
+		if (!buffer_end) {
+			fprintf(stderr, "Failed set: %s target ID: %s. Message queue out of memory. %s\n", String(p_prop).utf8().get_data(), itos(p_id).utf8().get_data(), error_text.utf8().get_data());
+			return ERR_OUT_OF_MEMORY;
+		}
+		_write_set(buffer_end, p_id, p_prop, p_value);
+		return OK;
+	}
+
+	LOCK_MUTEX;
+
+	if (thread_buffer_messages.get()) {
+		_link_thread_buffers();
+	}
+
 	_ensure_first_page();
 
 	if ((page_bytes[pages_used - 1] + room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
-		if (pages_used == max_pages) {
+		if (!_reserve_page()) {
 			String type;
 			if (ObjectDB::get_instance(p_id)) {
 				type = ObjectDB::get_instance(p_id)->get_class();
@@ -157,15 +340,7 @@ Error CallQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant
 	Page *page = pages[pages_used - 1];
 	uint8_t *buffer_end = &page->data[page_bytes[pages_used - 1]];
 
-	Message *msg = memnew_placement(buffer_end, Message);
-	msg->args = 1;
-	msg->callable = Callable(p_id, p_prop);
-	msg->type = TYPE_SET;
-
-	buffer_end += sizeof(Message);
-
-	Variant *v = memnew_placement(buffer_end, Variant);
-	*v = p_value;
+	_write_set(buffer_end, p_id, p_prop, p_value);
 
 	page_bytes[pages_used - 1] += room_needed;
 	UNLOCK_MUTEX;
@@ -175,13 +350,29 @@ Error CallQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant
 
 Error CallQueue::push_notification(ObjectID p_id, int p_notification) {
 	ERR_FAIL_COND_V(p_notification < 0, ERR_INVALID_PARAMETER);
-	LOCK_MUTEX;
 	uint32_t room_needed = sizeof(Message);
 
+	if (ThreadBuffer *thread_buffer = _get_thread_buffer()) {
+		MutexLock lock(thread_buffer->mutex);
+		uint8_t *buffer_end = _thread_buffer_reserve(thread_buffer, room_needed);
+		if (!buffer_end) {
+			fprintf(stderr, "Failed notification: %d target ID: %s. Message queue out of memory. %s\n", p_notification, itos(p_id).utf8().get_data(), error_text.utf8().get_data());
+			return ERR_OUT_OF_MEMORY;
+		}
+		_write_notification(buffer_end, p_id, p_notification);
+		return OK;
+	}
+
+	LOCK_MUTEX;
+
+	if (thread_buffer_messages.get()) {
+		_link_thread_buffers();
+	}
+
 	_ensure_first_page();
 
 	if ((page_bytes[pages_used - 1] + room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
-		if (pages_used == max_pages) {
+		if (!_reserve_page()) {
 			fprintf(stderr, "Failed notification: %d target ID: %s. Message queue out of memory. %s\n", p_notification, itos(p_id).utf8().get_data(), error_text.utf8().get_data());
 			statistics();
 			UNLOCK_MUTEX;
@@ -193,12 +384,7 @@ Error CallQueue::push_notification(ObjectID p_id, int p_notification) {
 	Page *page = pages[pages_used - 1];
 	uint8_t *buffer_end = &page->data[page_bytes[pages_used - 1]];
 
-	Message *msg = memnew_placement(buffer_end, Message);
-
-	msg->type = TYPE_NOTIFICATION;
-	msg->callable = Callable(p_id, CoreStringName(notification)); //name is meaningless but callable needs it
-	//msg->target;
-	msg->notification = p_notification;
+	_write_notification(buffer_end, p_id, p_notification);
 
 	page_bytes[pages_used - 1] += room_needed;
 	UNLOCK_MUTEX;
@@ -226,6 +412,10 @@ void CallQueue::_call_function(const Callable &p_callable, const Variant *p_args
 Error CallQueue::flush() {
 	LOCK_MUTEX;
 
+	if (thread_buffer_messages.get()) {
+		_link_thread_buffers();
+	}
+
 	if (pages.size() == 0) {
 		// Never allocated
 		UNLOCK_MUTEX;
@@ -295,10 +485,14 @@ Error CallQueue::flush() {
 			i++;
 			offset = 0;
 		}
+
+		if (!(i < pages_used && offset < page_bytes[i]) && thread_buffer_messages.get()) {
+			// Threads pushed while flushing, run those too.
+			_link_thread_buffers();
+		}
 	}
 
-	page_bytes[0] = 0;
-	pages_used = 1;
+	_release_pages();
 
 	flushing = false;
 	UNLOCK_MUTEX;
@@ -308,6 +502,10 @@ Error CallQueue::flush() {
 void CallQueue::clear() {
 	LOCK_MUTEX;
 
+	if (thread_buffer_messages.get()) {
+		_link_thread_buffers();
+	}
+
 	if (pages.size() == 0) {
 		UNLOCK_MUTEX;
 		return; // Nothing to clear.
@@ -340,8 +538,7 @@ void CallQueue::clear() {
 		}
 	}
 
-	pages_used = 1;
-	page_bytes[0] = 0;
+	_release_pages();
 
 	UNLOCK_MUTEX;
 }
@@ -446,6 +643,9 @@ bool CallQueue::is_flushing() const {
 }
 
 bool CallQueue::has_messages() const {
+	if (thread_buffer_messages.get()) {
+		return true;
+	}
 	if (pages_used == 0) {
 		return false;
 	}
@@ -457,7 +657,7 @@ bool CallQueue::has_messages() const {
 }
 
 int CallQueue::get_max_buffer_usage() const {
-	return pages.size() * PAGE_SIZE_BYTES;
+	return pages_allocated.get() * PAGE_SIZE_BYTES;
 }
 
 CallQueue::CallQueue(Allocator *p_custom_allocator, uint32_t p_max_pages, const String &p_error_text) {
@@ -474,10 +674,19 @@ CallQueue::CallQueue(Allocator *p_custom_allocator, uint32_t p_max_pages, const
 
 CallQueue::~CallQueue() {
 	clear();
+	for (ThreadBuffer *buffer : thread_buffers) {
+		for (Page *page : buffer->pages) {
+			allocator->free(page);
+		}
+		memdelete(buffer);
+	}
 	// Let go of pages.
 	for (uint32_t i = 0; i < pages.size(); i++) {
 		allocator->free(pages[i]);
 	}
+	for (Page *page : spare_pages) {
+		allocator->free(page);
+	}
 	if (!allocator_is_custom) {
 		memdelete(allocator);
 	}
@@ -488,6 +697,7 @@ CallQueue::~CallQueue() {
 
 CallQueue *MessageQueue::main_singleton = nullptr;
 thread_local CallQueue *MessageQueue::thread_singleton = nullptr;
+thread_local CallQueue::ThreadBufferOwner CallQueue::thread_buffer_owner;
 
 void MessageQueue::set_thread_singleton_override(CallQueue *p_thread_singleton) {
 #ifdef DEV_ENABLED
@@ -509,6 +719,7 @@ MessageQueue::MessageQueue() :
 				"Message queue out of memory. Try increasing 'memory/limits/message_queue/max_size_mb' in project settings.") {
 	ERR_FAIL_COND_MSG(main_singleton != nullptr, "A MessageQueue singleton already exists.");
 	main_singleton = this;
+	use_thread_buffers = true;
 }
 
 MessageQueue::~MessageQueue() {
@@ -32,6 +32,7 @@
 #define MESSAGE_QUEUE_H
 
 #include "core/object/object_id.h"
+#include "core/os/thread.h"
 #include "core/os/thread_safe.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/paged_allocator.h"
@@ -75,8 +76,39 @@ private:
 	LocalVector<uint32_t> page_bytes;
 	uint32_t max_pages = 0;
 	uint32_t pages_used = 0;
+	SafeNumeric<uint32_t> pages_in_use; // In the queue and in thread buffers, bounded by max_pages.
+
+	// Pages not in use, shared by the queue and the thread buffers, so memory stays at the peak usage.
+	BinaryMutex spare_pages_mutex; // Always locked last.
+	LocalVector<Page *> spare_pages;
+	SafeNumeric<uint32_t> pages_allocated;
 	bool flushing = false;
 
+	// Messages pushed from threads other than the main one go to a buffer owned by the pushing
+	// thread, so producers don't contend with each other. Buffers are linked after the pages
+	// already in the queue whenever the main thread pushes or flushes, which keeps messages in
+	// order per thread and with respect to anything the main thread pushes after synchronizing
+	// with that thread.
+	struct ThreadBuffer {
+		BinaryMutex mutex; // Only contended while being linked into the queue.
+		LocalVector<Page *> pages;
+		LocalVector<uint32_t> page_bytes;
+		uint32_t messages = 0;
+		bool thread_exited = false;
+	};
+
+	struct ThreadBufferOwner {
+		CallQueue *queue = nullptr;
+		ThreadBuffer *buffer = nullptr;
+		~ThreadBufferOwner();
+	};
+
+	static thread_local ThreadBufferOwner thread_buffer_owner;
+
+	bool use_thread_buffers = false;
+	LocalVector<ThreadBuffer *> thread_buffers;
+	SafeNumeric<uint32_t> thread_buffer_messages;
+
 #ifdef DEV_ENABLED
 	bool is_current_thread_override = false;
 #endif
@@ -92,13 +124,26 @@ private:
 
 	_FORCE_INLINE_ void _ensure_first_page() {
 		if (unlikely(pages.is_empty())) {
-			pages.push_back(allocator->alloc());
+			pages.push_back(_alloc_page());
 			page_bytes.push_back(0);
 			pages_used = 1;
+			pages_in_use.increment();
 		}
 	}
 
+	Page *_alloc_page();
+	void _free_page(Page *p_page);
+	bool _reserve_page();
 	void _add_page();
+	void _release_pages();
+
+	ThreadBuffer *_get_thread_buffer();
+	uint8_t *_thread_buffer_reserve(ThreadBuffer *p_buffer, uint32_t p_room_needed);
+	void _link_thread_buffers();
+
+	void _write_call(uint8_t *p_buffer, const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error);
+	void _write_set(uint8_t *p_buffer, ObjectID p_id, const StringName &p_prop, const Variant &p_value);
+	void _write_notification(uint8_t *p_buffer, ObjectID p_id, int p_notification);
 
 	void _call_function(const Callable &p_callable, const Variant *p_args, int p_argcount, bool p_show_error);
 
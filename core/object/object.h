@@ -618,9 +618,20 @@ private:
 			List<Connection>::Element *cE = nullptr;
 		};
 
+		struct EmitSlot {
+			Callable callable;
+			uint32_t flags = 0;
+		};
+
 		MethodInfo user;
 		HashMap<Callable, Slot, HashableHasher<Callable>> slot_map;
+		// Contiguous snapshot of slot_map used for emission, rebuilt on the first emission after connections change.
+		// Emitting only takes a copy-on-write reference to it, which keeps the callables alive without copying them.
+		Vector<EmitSlot> emit_slots;
+		bool emit_slots_dirty = false;
 		bool removable = false;
+
+		void update_emit_slots();
 	};
 
 	HashMap<StringName, SignalData> signal_map;
@@ -1003,6 +1014,21 @@ public:
 	virtual ~Object();
 };
 
+#ifdef DEBUG_ENABLED
+// Keeps an object from being freed while one of its methods runs, see `Object::callp()`.
+struct _ObjectDebugLock {
+	Object *obj;
+
+	_ObjectDebugLock(Object *p_obj) {
+		obj = p_obj;
+		obj->_lock_index.ref();
+	}
+	~_ObjectDebugLock() {
+		obj->_lock_index.unref();
+	}
+};
+#endif
+
 bool predelete_handler(Object *p_object);
 void postinitialize_handler(Object *p_object);
 
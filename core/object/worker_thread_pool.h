@@ -69,6 +69,8 @@ private:
 		SafeFlag completed;
 		SafeNumeric<uint32_t> finished;
 		uint32_t tasks_used = 0;
+		bool dependents_released = false;
+		LocalVector<Task *> dependents; // Tasks waiting for this group to complete before being posted.
 	};
 
 	struct Task {
@@ -86,8 +88,11 @@ private:
 		uint32_t waiting_pool = 0;
 		uint32_t waiting_user = 0;
 		bool low_priority = false;
+		int priority = 0; // Order in the low priority queue; higher goes first.
 		BaseTemplateUserdata *template_userdata = nullptr;
 		int pool_thread_index = -1;
+		uint32_t pending_dependencies = 0;
+		LocalVector<Task *> dependents; // Tasks waiting for this one to complete before being posted.
 
 		void free_template_userdata();
 		Task() :
@@ -107,6 +112,21 @@ private:
 
 	BinaryMutex task_mutex;
 
+	// Chase-Lev work-stealing deque. Only the owning pool thread pushes and pops
+	// (LIFO, from the bottom); any thread can steal (FIFO, from the top).
+	struct LocalTaskQueue {
+		static const int64_t CAPACITY = 256; // Must be a power of two.
+
+		std::atomic<int64_t> top = 0;
+		std::atomic<int64_t> bottom = 0;
+		std::atomic<Task *> buffer[CAPACITY] = {};
+
+		bool push(Task *p_task);
+		Task *pop();
+		Task *steal();
+		_FORCE_INLINE_ bool is_empty() const { return bottom.load(std::memory_order_acquire) <= top.load(std::memory_order_acquire); }
+	};
+
 	struct ThreadData {
 		static Task *const YIELDING; // Too bad constexpr doesn't work here.
 
@@ -118,6 +138,7 @@ private:
 		Task *current_task = nullptr;
 		Task *awaited_task = nullptr; // Null if not awaiting the condition variable, or special value (YIELDING).
 		ConditionVariable cond_var;
+		LocalTaskQueue local_queue; // High priority tasks posted from this thread.
 
 		ThreadData() :
 				ready_for_scripting(false),
@@ -158,6 +179,10 @@ private:
 	void _notify_threads(const ThreadData *p_current_thread_data, uint32_t p_process_count, uint32_t p_promote_count);
 
 	bool _try_promote_low_priority_task();
+	void _queue_low_priority_task(Task *p_task);
+	bool _register_dependencies(Task **p_tasks, uint32_t p_count, const Vector<TaskID> &p_dependencies);
+	void _release_dependents(LocalVector<Task *> &p_dependents, LocalVector<Task *> &r_ready);
+	Task *_steal_task(const ThreadData *p_thief);
 
 	static WorkerThreadPool *singleton;
 
@@ -166,8 +191,8 @@ private:
 	static thread_local uintptr_t unlockable_mutexes[MAX_UNLOCKABLE_MUTEXES];
 #endif
 
-	TaskID _add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description);
-	GroupID _add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description);
+	TaskID _add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description, const Vector<TaskID> &p_dependencies = Vector<TaskID>());
+	GroupID _add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description, const Vector<TaskID> &p_dependencies = Vector<TaskID>());
 
 	template <typename C, typename M, typename U>
 	struct TaskUserData : public BaseTemplateUserdata {
@@ -214,7 +239,12 @@ public:
 	TaskID add_native_task(void (*p_func)(void *), void *p_userdata, bool p_high_priority = false, const String &p_description = String());
 	TaskID add_task(const Callable &p_action, bool p_high_priority = false, const String &p_description = String());
 
+	// The task is only posted once every task or group in p_dependencies has completed.
+	TaskID add_native_task_with_dependencies(void (*p_func)(void *), void *p_userdata, const Vector<TaskID> &p_dependencies, bool p_high_priority = false, const String &p_description = String());
+	TaskID add_task_with_dependencies(const Callable &p_action, const Vector<TaskID> &p_dependencies, bool p_high_priority = false, const String &p_description = String());
+
 	bool is_task_completed(TaskID p_task_id) const;
+	void set_task_priority(TaskID p_task_id, int p_priority);
 	Error wait_for_task_completion(TaskID p_task_id);
 
 	void yield();
@@ -231,6 +261,8 @@ public:
 	}
 	GroupID add_native_group_task(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
 	GroupID add_group_task(const Callable &p_action, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
+	GroupID add_native_group_task_with_dependencies(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, const Vector<TaskID> &p_dependencies, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
+	GroupID add_group_task_with_dependencies(const Callable &p_action, int p_elements, const Vector<TaskID> &p_dependencies, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
 	uint32_t get_group_processed_element_count(GroupID p_group) const;
 	bool is_group_task_completed(GroupID p_group) const;
 	void wait_for_group_task_completion(GroupID p_group);
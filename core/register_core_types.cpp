@@ -309,6 +309,8 @@ void register_core_settings() {
 
 	GLOBAL_DEF("threading/worker_pool/max_threads", -1);
 	GLOBAL_DEF("threading/worker_pool/low_priority_thread_ratio", 0.3);
+
+	ResourceCache::set_retained_budget(uint64_t(GLOBAL_DEF(PropertyInfo(Variant::INT, "memory/limits/resource_cache/retained_budget_mb", PROPERTY_HINT_RANGE, "0,4096,1,or_greater"), 0)) * 1024 * 1024);
 }
 
 void register_core_singletons() {
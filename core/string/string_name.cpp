@@ -47,6 +47,7 @@ StringName _scs_create(const char *p_chr, bool p_static) {
 
 bool StringName::configured = false;
 Mutex StringName::mutex;
+BinaryMutex StringName::bucket_mutexes[STRING_TABLE_LOCK_COUNT];
 
 #ifdef DEBUG_ENABLED
 bool StringName::debug_stringname = false;
@@ -120,28 +121,36 @@ void StringName::unref() {
 	ERR_FAIL_COND(!configured);
 
 	if (_data && _data->refcount.unref()) {
-		MutexLock lock(mutex);
-
-		if (CoreGlobals::leak_reporting_enabled && _data->static_count.get() > 0) {
-			if (_data->cname) {
-				ERR_PRINT("BUG: Unreferenced static string to 0: " + String(_data->cname));
+		// Errors are printed after unlocking, since printing may need the same lock to create StringNames.
+		bool static_unreferenced = false;
+		String static_name;
+		bool table_corrupt = false;
+		{
+			MutexLock lock(bucket_mutexes[_data->idx & STRING_TABLE_LOCK_MASK]);
+
+			if (CoreGlobals::leak_reporting_enabled && _data->static_count.get() > 0) {
+				static_unreferenced = true;
+				static_name = _data->cname ? String(_data->cname) : _data->name;
+			}
+			if (_data->prev) {
+				_data->prev->next = _data->next;
 			} else {
-				ERR_PRINT("BUG: Unreferenced static string to 0: " + String(_data->name));
+				table_corrupt = _table[_data->idx] != _data;
+				_table[_data->idx] = _data->next;
 			}
-		}
-		if (_data->prev) {
-			_data->prev->next = _data->next;
-		} else {
-			if (_table[_data->idx] != _data) {
-				ERR_PRINT("BUG!");
+
+			if (_data->next) {
+				_data->next->prev = _data->prev;
 			}
-			_table[_data->idx] = _data->next;
+			memdelete(_data);
 		}
 
-		if (_data->next) {
-			_data->next->prev = _data->prev;
+		if (static_unreferenced) {
+			ERR_PRINT("BUG: Unreferenced static string to 0: " + static_name);
+		}
+		if (table_corrupt) {
+			ERR_PRINT("BUG!");
 		}
-		memdelete(_data);
 	}
 
 	_data = nullptr;
@@ -216,12 +225,12 @@ StringName::StringName(const char *p_name, bool p_static) {
 		return; //empty, ignore
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_name);
 
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
+	MutexLock lock(bucket_mutexes[idx & STRING_TABLE_LOCK_MASK]);
+
 	_data = _table[idx];
 
 	while (_data) {
@@ -275,12 +284,12 @@ StringName::StringName(const StaticCString &p_static_string, bool p_static) {
 
 	ERR_FAIL_COND(!p_static_string.ptr || !p_static_string.ptr[0]);
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_static_string.ptr);
 
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
+	MutexLock lock(bucket_mutexes[idx & STRING_TABLE_LOCK_MASK]);
+
 	_data = _table[idx];
 
 	while (_data) {
@@ -335,11 +344,11 @@ StringName::StringName(const String &p_name, bool p_static) {
 		return;
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = p_name.hash();
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
+	MutexLock lock(bucket_mutexes[idx & STRING_TABLE_LOCK_MASK]);
+
 	_data = _table[idx];
 
 	while (_data) {
@@ -393,11 +402,11 @@ StringName StringName::search(const char *p_name) {
 		return StringName();
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_name);
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
+	MutexLock lock(bucket_mutexes[idx & STRING_TABLE_LOCK_MASK]);
+
 	_Data *_data = _table[idx];
 
 	while (_data) {
@@ -429,12 +438,12 @@ StringName StringName::search(const char32_t *p_name) {
 		return StringName();
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_name);
 
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
+	MutexLock lock(bucket_mutexes[idx & STRING_TABLE_LOCK_MASK]);
+
 	_Data *_data = _table[idx];
 
 	while (_data) {
@@ -455,12 +464,12 @@ StringName StringName::search(const char32_t *p_name) {
 StringName StringName::search(const String &p_name) {
 	ERR_FAIL_COND_V(p_name.is_empty(), StringName());
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = p_name.hash();
 
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
+	MutexLock lock(bucket_mutexes[idx & STRING_TABLE_LOCK_MASK]);
+
 	_Data *_data = _table[idx];
 
 	while (_data) {
@@ -48,7 +48,10 @@ class StringName {
 	enum {
 		STRING_TABLE_BITS = 16,
 		STRING_TABLE_LEN = 1 << STRING_TABLE_BITS,
-		STRING_TABLE_MASK = STRING_TABLE_LEN - 1
+		STRING_TABLE_MASK = STRING_TABLE_LEN - 1,
+		STRING_TABLE_LOCK_BITS = 6,
+		STRING_TABLE_LOCK_COUNT = 1 << STRING_TABLE_LOCK_BITS,
+		STRING_TABLE_LOCK_MASK = STRING_TABLE_LOCK_COUNT - 1
 	};
 
 	struct _Data {
@@ -76,6 +79,8 @@ class StringName {
 	friend void unregister_core_types();
 	friend class Main;
 	static Mutex mutex;
+	// Buckets are striped across these locks, so threads interning unrelated names don't contend.
+	static BinaryMutex bucket_mutexes[STRING_TABLE_LOCK_COUNT];
 	static void setup();
 	static void cleanup();
 	static bool configured;
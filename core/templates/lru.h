@@ -84,6 +84,33 @@ public:
 		return _map.getptr(p_key);
 	}
 
+	bool erase(const TKey &p_key) {
+		Element *e = _map.getptr(p_key);
+		if (!e) {
+			return false;
+		}
+		_list.erase(*e);
+		_map.erase(p_key);
+		return true;
+	}
+
+	// Least recently used entry, for callers evicting by criteria other than the entry count.
+	const TKey &get_back_key() const {
+		CRASH_COND(_list.is_empty());
+		return _list.back()->get().key;
+	}
+
+	const TData &get_back() const {
+		CRASH_COND(_list.is_empty());
+		return _list.back()->get().data;
+	}
+
+	void pop_back() {
+		ERR_FAIL_COND(_list.is_empty());
+		_map.erase(_list.back()->get().key);
+		_list.pop_back();
+	}
+
 	const TData &get(const TKey &p_key) {
 		Element *e = _map.getptr(p_key);
 		CRASH_COND(!e);
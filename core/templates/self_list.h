@@ -76,6 +76,23 @@ public:
 			_last = p_elem;
 		}
 
+		void insert_before(SelfList<T> *p_elem, SelfList<T> *p_next) {
+			ERR_FAIL_COND(p_elem->_root);
+			ERR_FAIL_COND(p_next->_root != this);
+
+			p_elem->_root = this;
+			p_elem->_next = p_next;
+			p_elem->_prev = p_next->_prev;
+
+			if (p_next->_prev) {
+				p_next->_prev->_next = p_elem;
+			} else {
+				_first = p_elem;
+			}
+
+			p_next->_prev = p_elem;
+		}
+
 		void remove(SelfList<T> *p_elem) {
 			ERR_FAIL_COND(p_elem->_root != this);
 			if (p_elem->_next) {
@@ -158,6 +175,8 @@ public:
 
 		_FORCE_INLINE_ SelfList<T> *first() { return _first; }
 		_FORCE_INLINE_ const SelfList<T> *first() const { return _first; }
+		_FORCE_INLINE_ SelfList<T> *last() { return _last; }
+		_FORCE_INLINE_ const SelfList<T> *last() const { return _last; }
 
 		// Forbid copying, which has broken behavior.
 		void operator=(const List &) = delete;
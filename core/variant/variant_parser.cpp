@@ -36,6 +36,7 @@
 #include "core/object/script_language.h"
 #include "core/os/keyboard.h"
 #include "core/string/string_buffer.h"
+#include "core/templates/local_vector.h"
 
 char32_t VariantParser::Stream::get_char() {
 	// is within buffer?
@@ -63,6 +64,30 @@ bool VariantParser::Stream::is_eof() const {
 	return _is_eof();
 }
 
+const char32_t *VariantParser::Stream::get_readahead(uint32_t &r_available) {
+	r_available = 0;
+	if (!readahead_enabled || saved || eof) {
+		return nullptr;
+	}
+
+	if (readahead_pointer >= readahead_filled) {
+		readahead_filled = _read_buffer(readahead_buffer, READAHEAD_SIZE);
+		readahead_pointer = 0;
+		if (!readahead_filled) {
+			// Leave EOF handling to get_char().
+			return nullptr;
+		}
+	}
+
+	r_available = readahead_filled - readahead_pointer;
+	return readahead_buffer + readahead_pointer;
+}
+
+void VariantParser::Stream::skip_readahead(uint32_t p_count) {
+	DEV_ASSERT(readahead_pointer + p_count <= readahead_filled);
+	readahead_pointer += p_count;
+}
+
 bool VariantParser::StreamFile::is_utf8() const {
 	return true;
 }
@@ -547,6 +572,114 @@ Error VariantParser::_parse_enginecfg(Stream *p_stream, Vector<String> &strings,
 	}
 }
 
+static uint32_t _skip_whitespace(const char32_t *p_chars, uint32_t p_count, uint32_t p_pos, int &r_lines) {
+	while (p_pos < p_count && p_chars[p_pos] != 0 && p_chars[p_pos] <= 32) {
+		if (p_chars[p_pos] == '\n') {
+			r_lines++;
+		}
+		p_pos++;
+	}
+	return p_pos;
+}
+
+// Reads a number with the same syntax get_token() accepts, but only when it can be converted
+// exactly (at most 15 significant digits and a power of ten that is exact in double precision),
+// and only when it ends before the end of the buffer. Anything else is left to get_token().
+static bool _parse_number_fast(const char32_t *p_chars, uint32_t p_count, uint32_t &r_pos, double &r_real, int64_t &r_int, bool &r_is_float) {
+	static const double powers_of_ten[23] = {
+		1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+	};
+
+	uint32_t pos = r_pos;
+	bool negative = false;
+	if (pos < p_count && p_chars[pos] == '-') {
+		negative = true;
+		pos++;
+	}
+
+	uint64_t mantissa = 0;
+	int digits = 0;
+	int exponent = 0;
+	bool any_digit = false;
+	r_is_float = false;
+
+	while (pos < p_count && is_digit(p_chars[pos])) {
+		if (mantissa || p_chars[pos] != '0') {
+			if (++digits > 15) {
+				return false;
+			}
+			mantissa = mantissa * 10 + (p_chars[pos] - '0');
+		}
+		any_digit = true;
+		pos++;
+	}
+
+	if (pos < p_count && p_chars[pos] == '.') {
+		r_is_float = true;
+		pos++;
+		while (pos < p_count && is_digit(p_chars[pos])) {
+			if (mantissa || p_chars[pos] != '0') {
+				if (++digits > 15) {
+					return false;
+				}
+				mantissa = mantissa * 10 + (p_chars[pos] - '0');
+			}
+			exponent--;
+			any_digit = true;
+			pos++;
+		}
+	}
+
+	if (!any_digit) {
+		return false;
+	}
+
+	if (pos < p_count && p_chars[pos] == 'e') {
+		r_is_float = true;
+		pos++;
+		bool exponent_negative = false;
+		if (pos < p_count && (p_chars[pos] == '-' || p_chars[pos] == '+')) {
+			exponent_negative = p_chars[pos] == '-';
+			pos++;
+		}
+		int exponent_value = 0;
+		bool exponent_digit = false;
+		while (pos < p_count && is_digit(p_chars[pos])) {
+			if (exponent_value < 10000) {
+				exponent_value = exponent_value * 10 + (p_chars[pos] - '0');
+			}
+			exponent_digit = true;
+			pos++;
+		}
+		if (!exponent_digit) {
+			return false;
+		}
+		exponent += exponent_negative ? -exponent_value : exponent_value;
+	}
+
+	if (pos >= p_count) {
+		// The number may continue past the buffer.
+		return false;
+	}
+
+	if (!r_is_float) {
+		r_int = negative ? -int64_t(mantissa) : int64_t(mantissa);
+	} else if (mantissa == 0) {
+		r_real = negative ? -0.0 : 0.0;
+	} else {
+		if (exponent < -22 || exponent > 22) {
+			return false;
+		}
+		// Both operands are exact, so a single operation rounds correctly.
+		double real = exponent < 0 ? double(mantissa) / powers_of_ten[-exponent] : double(mantissa) * powers_of_ten[exponent];
+		r_real = negative ? -real : real;
+	}
+
+	r_pos = pos;
+	return true;
+}
+
 template <typename T>
 Error VariantParser::_parse_construct(Stream *p_stream, Vector<T> &r_construct, int &line, String &r_err_str) {
 	Token token;
@@ -556,8 +689,52 @@ Error VariantParser::_parse_construct(Stream *p_stream, Vector<T> &r_construct,
 		return ERR_PARSE_ERROR;
 	}
 
+	LocalVector<T> values;
 	bool first = true;
 	while (true) {
+		// Fast path for large literals: read plain numbers straight from the read-ahead buffer,
+		// without building tokens or Variants. It stops at anything else (buffer end, comments,
+		// inf/nan, errors), which is handled one element at a time by get_token() below.
+		uint32_t available = 0;
+		const char32_t *chars = p_stream->get_readahead(available);
+		if (chars) {
+			uint32_t pos = 0;
+			bool closed = false;
+			while (true) {
+				uint32_t element_pos = pos;
+				int element_lines = 0;
+				pos = _skip_whitespace(chars, available, pos, element_lines);
+				if (pos < available && chars[pos] == ')') {
+					pos++;
+					line += element_lines;
+					closed = true;
+					break;
+				}
+				if (!first) {
+					if (pos >= available || chars[pos] != ',') {
+						pos = element_pos;
+						break;
+					}
+					pos = _skip_whitespace(chars, available, pos + 1, element_lines);
+				}
+
+				double real = 0;
+				int64_t integer = 0;
+				bool is_float = false;
+				if (!_parse_number_fast(chars, available, pos, real, integer, is_float)) {
+					pos = element_pos;
+					break;
+				}
+				values.push_back(is_float ? T(real) : T(integer));
+				line += element_lines;
+				first = false;
+			}
+			p_stream->skip_readahead(pos);
+			if (closed) {
+				break;
+			}
+		}
+
 		if (!first) {
 			get_token(p_stream, token, line, r_err_str);
 			if (token.type == TK_COMMA) {
@@ -589,10 +766,11 @@ Error VariantParser::_parse_construct(Stream *p_stream, Vector<T> &r_construct,
 			}
 		}
 
-		r_construct.push_back(token.value);
+		values.push_back(token.value);
 		first = false;
 	}
 
+	r_construct = values;
 	return OK;
 }
 
@@ -1248,17 +1426,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<int32_t> arr;
-			{
-				int32_t len = args.size();
-				arr.resize(len);
-				int32_t *w = arr.ptrw();
-				for (int32_t i = 0; i < len; i++) {
-					w[i] = int32_t(args[i]);
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedInt64Array") {
 			Vector<int64_t> args;
 			Error err = _parse_construct<int64_t>(p_stream, args, line, r_err_str);
@@ -1266,17 +1434,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<int64_t> arr;
-			{
-				int64_t len = args.size();
-				arr.resize(len);
-				int64_t *w = arr.ptrw();
-				for (int64_t i = 0; i < len; i++) {
-					w[i] = int64_t(args[i]);
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedFloat32Array" || id == "PackedRealArray" || id == "PoolRealArray" || id == "FloatArray") {
 			Vector<float> args;
 			Error err = _parse_construct<float>(p_stream, args, line, r_err_str);
@@ -1284,17 +1442,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<float> arr;
-			{
-				int len = args.size();
-				arr.resize(len);
-				float *w = arr.ptrw();
-				for (int i = 0; i < len; i++) {
-					w[i] = args[i];
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedFloat64Array") {
 			Vector<double> args;
 			Error err = _parse_construct<double>(p_stream, args, line, r_err_str);
@@ -1302,17 +1450,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<double> arr;
-			{
-				int len = args.size();
-				arr.resize(len);
-				double *w = arr.ptrw();
-				for (int i = 0; i < len; i++) {
-					w[i] = args[i];
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedStringArray" || id == "PoolStringArray" || id == "StringArray") {
 			get_token(p_stream, token, line, r_err_str);
 			if (token.type != TK_PARENTHESIS_OPEN) {
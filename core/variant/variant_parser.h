@@ -57,6 +57,11 @@ public:
 		virtual bool is_utf8() const = 0;
 		bool is_eof() const;
 
+		// Direct access to the characters read ahead, for bulk parsing. Returns nullptr if the
+		// stream doesn't read ahead or a character is pending in `saved`.
+		const char32_t *get_readahead(uint32_t &r_available);
+		void skip_readahead(uint32_t p_count);
+
 		Stream() {}
 		virtual ~Stream() {}
 	};
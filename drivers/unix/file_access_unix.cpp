@@ -37,6 +37,7 @@
 
 #include <errno.h>
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -132,6 +133,7 @@ Error FileAccessUnix::open_internal(const String &p_path, int p_mode_flags) {
 		fcntl(fd, F_SETFD, opts | FD_CLOEXEC);
 	}
 
+	map_failed = false;
 	last_error = OK;
 	flags = p_mode_flags;
 	return OK;
@@ -142,6 +144,12 @@ void FileAccessUnix::_close() {
 		return;
 	}
 
+	if (mapped) {
+		munmap(mapped, mapped_length);
+		mapped = nullptr;
+		mapped_length = 0;
+	}
+
 	fclose(f);
 	f = nullptr;
 
@@ -282,6 +290,42 @@ uint64_t FileAccessUnix::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return read;
 }
 
+const uint8_t *FileAccessUnix::get_mapped_buffer() const {
+	ERR_FAIL_NULL_V_MSG(f, nullptr, "File must be opened before use.");
+
+	if (mapped || map_failed) {
+		return mapped;
+	}
+
+#ifdef WEB_ENABLED
+	// Emscripten emulates mmap by copying the whole file, reading it is cheaper.
+	map_failed = true;
+	return nullptr;
+#else
+	// Only read-only files are mapped, the view must not change under the reader.
+	if (flags != READ) {
+		map_failed = true;
+		return nullptr;
+	}
+
+	struct stat st = {};
+	if (fstat(fileno(f), &st) != 0 || st.st_size <= 0) {
+		map_failed = true;
+		return nullptr;
+	}
+
+	void *ptr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fileno(f), 0);
+	if (ptr == MAP_FAILED) {
+		map_failed = true;
+		return nullptr;
+	}
+
+	mapped = (uint8_t *)ptr;
+	mapped_length = st.st_size;
+	return mapped;
+#endif
+}
+
 Error FileAccessUnix::get_error() const {
 	return last_error;
 }
@@ -43,6 +43,9 @@ typedef void (*CloseNotificationFunc)(const String &p_file, int p_flags);
 class FileAccessUnix : public FileAccess {
 	FILE *f = nullptr;
 	int flags = 0;
+	mutable uint8_t *mapped = nullptr;
+	mutable uint64_t mapped_length = 0;
+	mutable bool map_failed = false;
 	void check_errors() const;
 	mutable Error last_error = OK;
 	String save_path;
@@ -72,6 +75,7 @@ public:
 	virtual uint32_t get_32() const override;
 	virtual uint64_t get_64() const override;
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+	virtual const uint8_t *get_mapped_buffer() const override;
 
 	virtual Error get_error() const override; ///< get last error
 
@@ -4257,6 +4257,7 @@ void Main::cleanup(bool p_force) {
 	}
 
 	ResourceLoader::clear_thread_load_tasks();
+	ResourceCache::clear_retained();
 
 	ResourceLoader::remove_custom_loaders();
 	ResourceSaver::remove_custom_savers();
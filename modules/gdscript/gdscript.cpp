@@ -769,7 +769,7 @@ Error GDScript::reload(bool p_keep_state) {
 		}
 		if (!source_path.is_empty()) {
 			if (GDScriptCache::get_cached_script(source_path).is_null()) {
-				MutexLock lock(GDScriptCache::singleton->mutex);
+				GDScriptCache::CacheLock lock;
 				GDScriptCache::singleton->shallow_gdscript_cache[source_path] = Ref<GDScript>(this);
 			}
 			if (GDScriptCache::has_parser(source_path)) {
@@ -2236,6 +2236,32 @@ void GDScriptLanguage::init() {
 		_add_global(E.name, E.ptr);
 	}
 
+#ifdef DEBUG_ENABLED
+	EngineDebugger::Profiler sampler(
+			this,
+			[](void *p_user, bool p_enable, const Array &p_opts) {
+				GDScriptLanguage *lang = static_cast<GDScriptLanguage *>(p_user);
+				if (p_enable) {
+					uint64_t interval = 1000;
+					if (p_opts.size() > 0 && p_opts[0].get_type() == Variant::INT) {
+						interval = MAX(int64_t(p_opts[0]), 0); // Clamped by sampling_start().
+					}
+					lang->sampling_start(interval);
+				} else {
+					lang->sampling_stop();
+					if (EngineDebugger::is_active()) {
+						Array samples;
+						samples.push_back(lang->sample_count);
+						samples.push_back(lang->sampling_get_folded_stacks());
+						samples.push_back(lang->sampling_get_line_samples());
+						EngineDebugger::get_singleton()->send_message("gdscript_sampler:samples", samples);
+					}
+				}
+			},
+			nullptr, nullptr);
+	EngineDebugger::register_profiler("gdscript_sampler", sampler);
+#endif
+
 #ifdef TESTS_ENABLED
 	GDScriptTests::GDScriptTestRunner::handle_cmdline();
 #endif
@@ -2255,6 +2281,13 @@ void GDScriptLanguage::finish() {
 	}
 	finishing = true;
 
+#ifdef DEBUG_ENABLED
+	if (EngineDebugger::has_profiler("gdscript_sampler")) {
+		EngineDebugger::unregister_profiler("gdscript_sampler");
+	}
+	sampling_stop();
+#endif
+
 	_call_stack.free();
 
 	// Clear the cache before parsing the script_list
@@ -2333,6 +2366,110 @@ void GDScriptLanguage::profiling_stop() {
 #endif
 }
 
+#ifdef DEBUG_ENABLED
+void GDScriptLanguage::_sampling_thread_func(void *p_userdata) {
+	GDScriptLanguage *lang = static_cast<GDScriptLanguage *>(p_userdata);
+	while (lang->sampling.is_set()) {
+		OS::get_singleton()->delay_usec(lang->sampling_interval_usec);
+		// Published before the epoch, so threads seeing the new epoch see this time too.
+		sampling_clock_usec.set(OS::get_singleton()->get_ticks_usec());
+		sampling_epoch.increment();
+	}
+}
+
+void GDScriptLanguage::_sample_resync() {
+	_call_stack.sample_epoch = sampling_epoch.get();
+	_call_stack.sample_clock_usec = OS::get_singleton()->get_ticks_usec();
+}
+
+void GDScriptLanguage::_take_sample(uint64_t p_weight) {
+	if (_call_stack.stack_pos == 0) {
+		return;
+	}
+
+	// Frames go from the outermost call to the innermost one, as expected by
+	// folded stack consumers (flamegraph.pl, speedscope, etc.).
+	String stack;
+	String leaf;
+	for (int i = 0; i < _call_stack.stack_pos; i++) {
+		const CallLevel &cl = _call_stack.levels[i];
+		String path = (cl.function && cl.function->get_script()) ? cl.function->get_script()->get_script_path() : String("<unknown>");
+		int line = cl.line ? *cl.line : 0;
+		if (i > 0) {
+			stack += ";";
+		}
+		stack += path + ":" + String(cl.function ? cl.function->get_name() : StringName()) + ":" + itos(line);
+		if (i == _call_stack.stack_pos - 1) {
+			leaf = path + ":" + itos(line);
+		}
+	}
+
+	MutexLock lock(sampling_mutex);
+	sampled_stacks[stack] += p_weight;
+	sampled_lines[leaf] += p_weight;
+	sample_count++;
+}
+#endif
+
+void GDScriptLanguage::sampling_start(uint64_t p_interval_usec) {
+#ifdef DEBUG_ENABLED
+	if (sampling.is_set()) {
+		return;
+	}
+
+	{
+		MutexLock lock(sampling_mutex);
+		sampled_stacks.clear();
+		sampled_lines.clear();
+		sample_count = 0;
+	}
+
+	sampling_interval_usec = MAX(p_interval_usec, SAMPLING_MIN_INTERVAL_USEC);
+	sampling_start_usec.set(OS::get_singleton()->get_ticks_usec());
+	sampling.set();
+	sampling_thread.start(_sampling_thread_func, this);
+#endif
+}
+
+void GDScriptLanguage::sampling_stop() {
+#ifdef DEBUG_ENABLED
+	sampling.clear();
+	if (sampling_thread.is_started()) {
+		sampling_thread.wait_to_finish();
+	}
+#endif
+}
+
+bool GDScriptLanguage::is_sampling() const {
+#ifdef DEBUG_ENABLED
+	return sampling.is_set();
+#else
+	return false;
+#endif
+}
+
+String GDScriptLanguage::sampling_get_folded_stacks() const {
+	String folded;
+#ifdef DEBUG_ENABLED
+	MutexLock lock(sampling_mutex);
+	for (const KeyValue<String, uint64_t> &E : sampled_stacks) {
+		folded += E.key + " " + itos(E.value) + "\n";
+	}
+#endif
+	return folded;
+}
+
+Dictionary GDScriptLanguage::sampling_get_line_samples() const {
+	Dictionary lines;
+#ifdef DEBUG_ENABLED
+	MutexLock lock(sampling_mutex);
+	for (const KeyValue<String, uint64_t> &E : sampled_lines) {
+		lines[E.key] = E.value;
+	}
+#endif
+	return lines;
+}
+
 int GDScriptLanguage::profiling_get_accumulated_data(ProfilingInfo *p_info_arr, int p_info_max) {
 	int current = 0;
 #ifdef DEBUG_ENABLED
@@ -2460,6 +2597,9 @@ struct GDScriptDepSort {
 };
 
 void GDScriptLanguage::reload_all_scripts() {
+	// Native method binds may have been replaced by an extension reload.
+	GDScriptFunction::invalidate_inline_caches();
+
 #ifdef DEBUG_ENABLED
 	print_verbose("GDScript: Reloading all scripts");
 	Array scripts;
@@ -2839,6 +2979,11 @@ String GDScriptLanguage::get_global_class_name(const String &p_path, String *r_b
 }
 
 thread_local GDScriptLanguage::CallStack GDScriptLanguage::_call_stack;
+#ifdef DEBUG_ENABLED
+SafeNumeric<uint32_t> GDScriptLanguage::sampling_epoch;
+SafeNumeric<uint64_t> GDScriptLanguage::sampling_clock_usec;
+SafeNumeric<uint64_t> GDScriptLanguage::sampling_start_usec;
+#endif
 
 GDScriptLanguage::GDScriptLanguage() {
 	calls = 0;
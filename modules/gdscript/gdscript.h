@@ -39,6 +39,7 @@
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
 #include "core/object/script_language.h"
+#include "core/os/thread.h"
 #include "core/templates/rb_set.h"
 
 class GDScriptNativeClass : public RefCounted {
@@ -432,6 +433,8 @@ class GDScriptLanguage : public ScriptLanguage {
 	struct CallStack {
 		CallLevel *levels = nullptr;
 		int stack_pos = 0;
+		uint32_t sample_epoch = 0;
+		uint64_t sample_clock_usec = 0; // Sampling clock when this thread last took a sample.
 
 		void free() {
 			if (levels) {
@@ -465,6 +468,32 @@ class GDScriptLanguage : public ScriptLanguage {
 
 	HashMap<String, ObjectID> orphan_subclasses;
 
+#ifdef DEBUG_ENABLED
+	// Sampling profiler. A timer thread bumps the epoch at a fixed interval,
+	// and each script thread records its own call stack the next time it
+	// reaches a line while the epoch differs from the one it last saw.
+	// Samples are weighted by the time elapsed since the thread's previous
+	// sample, in microseconds, so epochs missed while running native code
+	// still count. Time spent outside of scripts is skipped when entering
+	// the outermost call.
+	static SafeNumeric<uint32_t> sampling_epoch;
+	static SafeNumeric<uint64_t> sampling_clock_usec; // Ticks when the epoch was last bumped.
+	static SafeNumeric<uint64_t> sampling_start_usec;
+	SafeFlag sampling;
+	uint64_t sampling_interval_usec = 1000;
+	Thread sampling_thread;
+	Mutex sampling_mutex;
+	HashMap<String, uint64_t> sampled_stacks;
+	HashMap<String, uint64_t> sampled_lines;
+	uint64_t sample_count = 0;
+
+	static void _sampling_thread_func(void *p_userdata);
+	void _sample_resync();
+	void _take_sample(uint64_t p_weight);
+
+	friend class TestGDScriptSamplingAccessor;
+#endif
+
 public:
 	int calls;
 
@@ -487,6 +516,12 @@ public:
 			return;
 		}
 
+#ifdef DEBUG_ENABLED
+		if (unlikely(_call_stack.stack_pos == 0 && sampling.is_set())) {
+			_sample_resync();
+		}
+#endif
+
 		_call_stack.levels[_call_stack.stack_pos].stack = p_stack;
 		_call_stack.levels[_call_stack.stack_pos].instance = p_instance;
 		_call_stack.levels[_call_stack.stack_pos].function = p_function;
@@ -509,6 +544,20 @@ public:
 		_call_stack.stack_pos--;
 	}
 
+#ifdef DEBUG_ENABLED
+	_FORCE_INLINE_ void sample_poll() {
+		if (unlikely(_call_stack.sample_epoch != sampling_epoch.get())) {
+			_call_stack.sample_epoch = sampling_epoch.get();
+			const uint64_t clock_usec = sampling_clock_usec.get();
+			const uint64_t since_usec = MAX(_call_stack.sample_clock_usec, sampling_start_usec.get());
+			_call_stack.sample_clock_usec = clock_usec;
+			if (sampling.is_set() && clock_usec > since_usec) {
+				_take_sample(clock_usec - since_usec);
+			}
+		}
+	}
+#endif
+
 	virtual Vector<StackInfo> debug_get_current_stack_info() override {
 		Vector<StackInfo> csi;
 		csi.resize(_call_stack.stack_pos);
@@ -614,6 +663,13 @@ public:
 	virtual int profiling_get_accumulated_data(ProfilingInfo *p_info_arr, int p_info_max) override;
 	virtual int profiling_get_frame_data(ProfilingInfo *p_info_arr, int p_info_max) override;
 
+	static constexpr uint64_t SAMPLING_MIN_INTERVAL_USEC = 50;
+	void sampling_start(uint64_t p_interval_usec);
+	void sampling_stop();
+	bool is_sampling() const;
+	String sampling_get_folded_stacks() const;
+	Dictionary sampling_get_line_samples() const;
+
 	/* LOADER FUNCTIONS */
 
 	virtual void get_recognized_extensions(List<String> *p_extensions) const override;
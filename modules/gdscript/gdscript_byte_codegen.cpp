@@ -398,6 +398,17 @@ GDScriptFunction *GDScriptByteCodeGenerator::write_end() {
 	if (debug_stack) {
 		function->stack_debug = stack_debug;
 	}
+	if (inline_cache_count) {
+		function->_inline_caches_count = inline_cache_count;
+		function->_inline_caches_ptr = memnew_arr(std::atomic<GDScriptFunction::InlineCache *>, inline_cache_count);
+		for (int i = 0; i < inline_cache_count; i++) {
+			function->_inline_caches_ptr[i].store(nullptr, std::memory_order_relaxed);
+		}
+	} else {
+		function->_inline_caches_count = 0;
+		function->_inline_caches_ptr = nullptr;
+	}
+
 	function->_stack_size = GDScriptFunction::FIXED_ADDRESSES_MAX + max_locals + temporaries.size();
 	function->_instruction_args_size = instr_args_max;
 
@@ -584,6 +595,39 @@ void GDScriptByteCodeGenerator::write_unary_operator(const Address &p_target, Va
 	}
 }
 
+static bool _is_numeric_operator(Variant::Operator p_operator, Variant::Type p_left_type, Variant::Type p_right_type) {
+	if (p_left_type != p_right_type || (p_left_type != Variant::INT && p_left_type != Variant::FLOAT)) {
+		return false;
+	}
+	switch (p_operator) {
+		case Variant::OP_ADD:
+		case Variant::OP_SUBTRACT:
+		case Variant::OP_MULTIPLY:
+		case Variant::OP_EQUAL:
+		case Variant::OP_NOT_EQUAL:
+		case Variant::OP_LESS:
+		case Variant::OP_LESS_EQUAL:
+		case Variant::OP_GREATER:
+		case Variant::OP_GREATER_EQUAL:
+			return true;
+		case Variant::OP_DIVIDE:
+			return p_left_type == Variant::FLOAT;
+		default:
+			return false;
+	}
+}
+
+static GDScriptFunction::Opcode _get_fused_operator_opcode(int p_operator_opcode, bool p_jump) {
+	switch (p_operator_opcode) {
+		case GDScriptFunction::OPCODE_OPERATOR_INT:
+			return p_jump ? GDScriptFunction::OPCODE_OPERATOR_INT_JUMP_IF_NOT : GDScriptFunction::OPCODE_OPERATOR_INT_ASSIGN;
+		case GDScriptFunction::OPCODE_OPERATOR_FLOAT:
+			return p_jump ? GDScriptFunction::OPCODE_OPERATOR_FLOAT_JUMP_IF_NOT : GDScriptFunction::OPCODE_OPERATOR_FLOAT_ASSIGN;
+		default:
+			return p_jump ? GDScriptFunction::OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT : GDScriptFunction::OPCODE_OPERATOR_VALIDATED_ASSIGN;
+	}
+}
+
 void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, Variant::Operator p_operator, const Address &p_left_operand, const Address &p_right_operand) {
 	// Avoid validated evaluator for modulo and division when operands are int, since there's no check for division by zero.
 	if (HAS_BUILTIN_TYPE(p_left_operand) && HAS_BUILTIN_TYPE(p_right_operand) && ((p_operator != Variant::OP_DIVIDE && p_operator != Variant::OP_MODULE) || p_left_operand.type.builtin_type != Variant::INT || p_right_operand.type.builtin_type != Variant::INT)) {
@@ -595,9 +639,23 @@ void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, V
 			}
 		}
 
+		if (p_target.mode == Address::TEMPORARY && _is_numeric_operator(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type)) {
+			// Evaluated in place on the raw int or float values, without going through the validated evaluator.
+			fusable_operator_pos = opcodes.size();
+			fusable_operator_target = p_target;
+
+			append_opcode(p_left_operand.type.builtin_type == Variant::INT ? GDScriptFunction::OPCODE_OPERATOR_INT : GDScriptFunction::OPCODE_OPERATOR_FLOAT);
+			append(p_left_operand);
+			append(p_right_operand);
+			append(p_target);
+			append(p_operator);
+			return;
+		}
+
 		// Gather specific operator.
 		Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
 
+		int operator_pos = opcodes.size();
 		append_opcode(GDScriptFunction::OPCODE_OPERATOR_VALIDATED);
 		append(p_left_operand);
 		append(p_right_operand);
@@ -606,6 +664,11 @@ void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, V
 #ifdef DEBUG_ENABLED
 		add_debug_name(operator_names, get_operation_pos(op_func), Variant::get_operator_name(p_operator));
 #endif
+		if (p_target.mode == Address::TEMPORARY) {
+			// The result may be consumed right away by a jump or an assignment.
+			fusable_operator_pos = operator_pos;
+			fusable_operator_target = p_target;
+		}
 		return;
 	}
 
@@ -663,16 +726,26 @@ void GDScriptByteCodeGenerator::write_type_test(const Address &p_target, const A
 	}
 }
 
-void GDScriptByteCodeGenerator::write_and_left_operand(const Address &p_left_operand) {
+void GDScriptByteCodeGenerator::append_jump_if_not(const Address &p_condition) {
+	if (can_fuse_operator(p_condition)) {
+		// The condition was just computed by a typed operator, so test it in the same instruction.
+		// The jump target is appended by the caller, right after the operator function index.
+		opcodes.write[fusable_operator_pos] = _get_fused_operator_opcode(opcodes[fusable_operator_pos], true);
+		fusable_operator_pos = -1;
+		return;
+	}
 	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_left_operand);
+	append(p_condition);
+}
+
+void GDScriptByteCodeGenerator::write_and_left_operand(const Address &p_left_operand) {
+	append_jump_if_not(p_left_operand);
 	logic_op_jump_pos1.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
 }
 
 void GDScriptByteCodeGenerator::write_and_right_operand(const Address &p_right_operand) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_right_operand);
+	append_jump_if_not(p_right_operand);
 	logic_op_jump_pos2.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
 }
@@ -728,8 +801,7 @@ void GDScriptByteCodeGenerator::write_start_ternary(const Address &p_target) {
 }
 
 void GDScriptByteCodeGenerator::write_ternary_condition(const Address &p_condition) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
+	append_jump_if_not(p_condition);
 	ternary_jump_fail_pos.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
 }
@@ -850,6 +922,7 @@ void GDScriptByteCodeGenerator::write_get_named(const Address &p_target, const S
 	append(p_source);
 	append(p_target);
 	append(p_name);
+	append(add_inline_cache()); // Inline cache for the member lookup.
 }
 
 void GDScriptByteCodeGenerator::write_set_member(const Address &p_value, const StringName &p_name) {
@@ -941,6 +1014,11 @@ void GDScriptByteCodeGenerator::write_assign(const Address &p_target, const Addr
 		append(p_target);
 		append(p_source);
 		append(p_target.type.builtin_type);
+	} else if (can_fuse_operator(p_source)) {
+		// Store the result of the previous typed operator in the same instruction.
+		opcodes.write[fusable_operator_pos] = _get_fused_operator_opcode(opcodes[fusable_operator_pos], false);
+		fusable_operator_pos = -1;
+		append(p_target);
 	} else {
 		append_opcode(GDScriptFunction::OPCODE_ASSIGN);
 		append(p_target);
@@ -970,6 +1048,7 @@ void GDScriptByteCodeGenerator::write_assign_default_parameter(const Address &p_
 		write_assign(p_dst, p_src);
 	}
 	function->default_arguments.push_back(opcodes.size());
+	fusable_operator_pos = -1; // Jump target.
 }
 
 void GDScriptByteCodeGenerator::write_store_global(const Address &p_dst, int p_global_index) {
@@ -1040,6 +1119,7 @@ void GDScriptByteCodeGenerator::write_call(const Address &p_target, const Addres
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append(add_inline_cache()); // Inline cache for the method lookup.
 	ct.cleanup();
 }
 
@@ -1065,6 +1145,7 @@ void GDScriptByteCodeGenerator::write_call_async(const Address &p_target, const
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append(add_inline_cache()); // Inline cache for the method lookup.
 	ct.cleanup();
 }
 
@@ -1299,6 +1380,7 @@ void GDScriptByteCodeGenerator::write_call_self(const Address &p_target, const S
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append(add_inline_cache()); // Inline cache for the method lookup.
 	ct.cleanup();
 }
 
@@ -1312,6 +1394,7 @@ void GDScriptByteCodeGenerator::write_call_self_async(const Address &p_target, c
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append(add_inline_cache()); // Inline cache for the method lookup.
 	ct.cleanup();
 }
 
@@ -1325,6 +1408,7 @@ void GDScriptByteCodeGenerator::write_call_script_function(const Address &p_targ
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append(add_inline_cache()); // Inline cache for the method lookup.
 	ct.cleanup();
 }
 
@@ -1442,8 +1526,7 @@ void GDScriptByteCodeGenerator::write_await(const Address &p_target, const Addre
 }
 
 void GDScriptByteCodeGenerator::write_if(const Address &p_condition) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
+	append_jump_if_not(p_condition);
 	if_jmp_addrs.push_back(opcodes.size());
 	append(0); // Jump destination, will be patched.
 }
@@ -1649,12 +1732,12 @@ void GDScriptByteCodeGenerator::write_endfor() {
 void GDScriptByteCodeGenerator::start_while_condition() {
 	current_breaks_to_patch.push_back(List<int>());
 	continue_addrs.push_back(opcodes.size());
+	fusable_operator_pos = -1; // Jump target.
 }
 
 void GDScriptByteCodeGenerator::write_while(const Address &p_condition) {
 	// Condition check.
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
+	append_jump_if_not(p_condition);
 	while_jmp_addrs.push_back(opcodes.size());
 	append(0); // End of loop address, will be patched.
 }
@@ -98,6 +98,7 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 	int max_locals = 0;
 	int current_line = 0;
 	int instr_args_max = 0;
+	int inline_cache_count = 0;
 
 #ifdef DEBUG_ENABLED
 	List<int> temp_stack;
@@ -158,6 +159,10 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 
 	List<List<int>> current_breaks_to_patch;
 
+	// Last typed operator, so the instruction consuming its result can be fused into it.
+	int fusable_operator_pos = -1;
+	Address fusable_operator_target;
+
 	void add_stack_identifier(const StringName &p_id, int p_stackpos) {
 		if (locals.size() > max_locals) {
 			max_locals = locals.size();
@@ -349,6 +354,10 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 		return pos;
 	}
 
+	int add_inline_cache() {
+		return inline_cache_count++;
+	}
+
 	CallTarget get_call_target(const Address &p_target, Variant::Type p_type = Variant::NIL);
 
 	int address_of(const Address &p_address) {
@@ -449,8 +458,16 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 
 	void patch_jump(int p_address) {
 		opcodes.write[p_address] = opcodes.size();
+		// Something jumps here, so the previous instruction can't be extended anymore.
+		fusable_operator_pos = -1;
 	}
 
+	bool can_fuse_operator(const Address &p_result) const {
+		return fusable_operator_pos >= 0 && opcodes.size() == fusable_operator_pos + 5 && p_result.mode == fusable_operator_target.mode && p_result.address == fusable_operator_target.address;
+	}
+
+	void append_jump_if_not(const Address &p_condition);
+
 public:
 	virtual uint32_t add_parameter(const StringName &p_name, bool p_is_optional, const GDScriptDataType &p_type) override;
 	virtual uint32_t add_local(const StringName &p_name, const GDScriptDataType &p_type) override;
@@ -36,6 +36,8 @@
 #include "gdscript_parser.h"
 
 #include "core/io/file_access.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/vector.h"
 
 GDScriptParserRef::Status GDScriptParserRef::get_status() const {
@@ -137,19 +139,20 @@ GDScriptParserRef::~GDScriptParserRef() {
 	clear();
 
 	if (!abandoned) {
-		MutexLock lock(GDScriptCache::singleton->mutex);
+		GDScriptCache::CacheLock lock;
 		GDScriptCache::singleton->parser_map.erase(path);
 	}
 }
 
 GDScriptCache *GDScriptCache::singleton = nullptr;
+thread_local int GDScriptCache::lock_depth = 0;
 
 void GDScriptCache::move_script(const String &p_from, const String &p_to) {
 	if (singleton == nullptr || p_from == p_to) {
 		return;
 	}
 
-	MutexLock lock(singleton->mutex);
+	CacheLock lock;
 
 	if (singleton->cleared) {
 		return;
@@ -173,7 +176,7 @@ void GDScriptCache::remove_script(const String &p_path) {
 		return;
 	}
 
-	MutexLock lock(singleton->mutex);
+	CacheLock lock;
 
 	if (singleton->cleared) {
 		return;
@@ -202,7 +205,7 @@ void GDScriptCache::remove_script(const String &p_path) {
 }
 
 Ref<GDScriptParserRef> GDScriptCache::get_parser(const String &p_path, GDScriptParserRef::Status p_status, Error &r_error, const String &p_owner) {
-	MutexLock lock(singleton->mutex);
+	CacheLock lock;
 	Ref<GDScriptParserRef> ref;
 	if (!p_owner.is_empty()) {
 		singleton->dependencies[p_owner].insert(p_path);
@@ -224,18 +227,20 @@ Ref<GDScriptParserRef> GDScriptCache::get_parser(const String &p_path, GDScriptP
 		ref->path = p_path;
 		singleton->parser_map[p_path] = ref.ptr();
 	}
+	// From now on the caller keeps the prefetched parser alive.
+	singleton->prefetched_parsers.erase(p_path);
 	r_error = ref->raise_status(p_status);
 
 	return ref;
 }
 
 bool GDScriptCache::has_parser(const String &p_path) {
-	MutexLock lock(singleton->mutex);
+	CacheLock lock;
 	return singleton->parser_map.has(p_path);
 }
 
 void GDScriptCache::remove_parser(const String &p_path) {
-	MutexLock lock(singleton->mutex);
+	CacheLock lock;
 
 	if (singleton->parser_map.has(p_path)) {
 		GDScriptParserRef *parser_ref = singleton->parser_map[p_path];
@@ -245,6 +250,7 @@ void GDScriptCache::remove_parser(const String &p_path) {
 
 	// Can't clear the parser because some other parser might be currently using it in the chain of calls.
 	singleton->parser_map.erase(p_path);
+	singleton->prefetched_parsers.erase(p_path);
 
 	// Have to copy while iterating, because parser_inverse_dependencies is modified.
 	HashSet<String> ideps = singleton->parser_inverse_dependencies[p_path];
@@ -254,6 +260,91 @@ void GDScriptCache::remove_parser(const String &p_path) {
 	}
 }
 
+void GDScriptCache::_prefetch_parser_task(void *p_userdata, uint32_t p_index) {
+	Ref<GDScriptParserRef> *refs = static_cast<Ref<GDScriptParserRef> *>(p_userdata);
+	refs[p_index]->raise_status(GDScriptParserRef::PARSED);
+}
+
+void GDScriptCache::_gather_dependencies(GDScriptParser *p_parser, HashSet<String> &r_visited, LocalVector<String> &r_pending) {
+	// Must be called with the cache locked.
+	HashSet<String> paths = p_parser->get_referenced_paths();
+	for (const StringName &name : p_parser->get_referenced_names()) {
+		if (ScriptServer::is_global_class(name)) {
+			paths.insert(ScriptServer::get_global_class_path(name));
+		}
+	}
+	for (const String &path : paths) {
+		if (r_visited.has(path) || singleton->parser_map.has(path) || singleton->full_gdscript_cache.has(path)) {
+			continue;
+		}
+		r_visited.insert(path);
+		String extension = path.get_extension().to_lower();
+		if (extension != "gd" && extension != "gdc") {
+			continue;
+		}
+		if (!FileAccess::exists(ResourceLoader::path_remap(path))) {
+			continue;
+		}
+		r_pending.push_back(path);
+	}
+}
+
+void GDScriptCache::prefetch_dependencies(const String &p_path) {
+	// Only done from the top level, so waiting for the pool never happens with the cache locked. Worker
+	// threads are left out too, so pool threads never wait on each other.
+	if (singleton == nullptr || lock_depth > 0 || WorkerThreadPool::get_thread_index() != -1) {
+		return;
+	}
+
+	HashSet<String> visited;
+	LocalVector<String> pending;
+	{
+		CacheLock lock;
+		if (singleton->cleared || singleton->full_gdscript_cache.has(p_path)) {
+			return;
+		}
+		visited.insert(p_path);
+		GDScriptParserRef **existing = singleton->parser_map.getptr(p_path);
+		if (!existing) {
+			pending.push_back(p_path);
+		} else if ((*existing)->get_status() >= GDScriptParserRef::PARSED && (*existing)->result == OK) {
+			_gather_dependencies((*existing)->get_parser(), visited, pending);
+		}
+	}
+
+	// One level of the dependency graph at a time: parse it in parallel without the lock, then register
+	// the parsers and gather the next level with the lock.
+	while (!pending.is_empty()) {
+		LocalVector<Ref<GDScriptParserRef>> refs;
+		refs.resize(pending.size());
+		for (uint32_t i = 0; i < pending.size(); i++) {
+			refs[i].instantiate();
+			refs[i]->path = pending[i];
+			// Not registered in `parser_map` yet, so they must not unregister on destruction.
+			refs[i]->abandoned = true;
+		}
+		pending.clear();
+
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(_prefetch_parser_task, refs.ptr(), refs.size(), -1, true, SNAME("GDScriptCache::prefetch_dependencies"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+		CacheLock lock;
+		if (singleton->cleared) {
+			return;
+		}
+		for (Ref<GDScriptParserRef> &ref : refs) {
+			// Another thread may have requested the same script in the meantime.
+			if (singleton->parser_map.has(ref->path) || singleton->full_gdscript_cache.has(ref->path) || ref->result != OK) {
+				continue;
+			}
+			ref->abandoned = false;
+			singleton->parser_map[ref->path] = ref.ptr();
+			singleton->prefetched_parsers[ref->path] = ref;
+			_gather_dependencies(ref->parser, visited, pending);
+		}
+	}
+}
+
 String GDScriptCache::get_source_code(const String &p_path) {
 	Vector<uint8_t> source_file;
 	Error err;
@@ -288,7 +379,9 @@ Vector<uint8_t> GDScriptCache::get_binary_tokens(const String &p_path) {
 }
 
 Ref<GDScript> GDScriptCache::get_shallow_script(const String &p_path, Error &r_error, const String &p_owner) {
-	MutexLock lock(singleton->mutex);
+	prefetch_dependencies(p_path);
+
+	CacheLock lock;
 	if (!p_owner.is_empty()) {
 		singleton->dependencies[p_owner].insert(p_path);
 	}
@@ -328,7 +421,9 @@ Ref<GDScript> GDScriptCache::get_shallow_script(const String &p_path, Error &r_e
 }
 
 Ref<GDScript> GDScriptCache::get_full_script(const String &p_path, Error &r_error, const String &p_owner, bool p_update_from_disk) {
-	MutexLock lock(singleton->mutex);
+	prefetch_dependencies(p_path);
+
+	CacheLock lock;
 
 	if (!p_owner.is_empty()) {
 		singleton->dependencies[p_owner].insert(p_path);
@@ -383,7 +478,7 @@ Ref<GDScript> GDScriptCache::get_full_script(const String &p_path, Error &r_erro
 }
 
 Ref<GDScript> GDScriptCache::get_cached_script(const String &p_path) {
-	MutexLock lock(singleton->mutex);
+	CacheLock lock;
 
 	if (singleton->full_gdscript_cache.has(p_path)) {
 		return singleton->full_gdscript_cache[p_path];
@@ -397,7 +492,7 @@ Ref<GDScript> GDScriptCache::get_cached_script(const String &p_path) {
 }
 
 Error GDScriptCache::finish_compiling(const String &p_owner) {
-	MutexLock lock(singleton->mutex);
+	CacheLock lock;
 
 	// Mark this as compiled.
 	Ref<GDScript> script = get_cached_script(p_owner);
@@ -437,7 +532,7 @@ void GDScriptCache::clear() {
 		return;
 	}
 
-	MutexLock lock(singleton->mutex);
+	CacheLock lock;
 
 	if (singleton->cleared) {
 		return;
@@ -463,6 +558,7 @@ void GDScriptCache::clear() {
 	}
 
 	singleton->parser_map.clear();
+	singleton->prefetched_parsers.clear();
 
 	for (Ref<GDScriptParserRef> &E : parser_map_refs) {
 		if (E.is_valid()) {
@@ -86,6 +86,8 @@ class GDScriptCache {
 	HashMap<String, Ref<GDScript>> static_gdscript_cache;
 	HashMap<String, HashSet<String>> dependencies;
 	HashMap<String, HashSet<String>> parser_inverse_dependencies;
+	// Parsers created ahead of time by `prefetch_dependencies()`, kept alive until requested.
+	HashMap<String, Ref<GDScriptParserRef>> prefetched_parsers;
 
 	friend class GDScript;
 	friend class GDScriptParserRef;
@@ -96,6 +98,23 @@ class GDScriptCache {
 	bool cleared = false;
 
 	Mutex mutex;
+	// How many times the current thread holds `mutex`, so `prefetch_dependencies()` only runs without it.
+	static thread_local int lock_depth;
+
+	class CacheLock {
+	public:
+		_FORCE_INLINE_ CacheLock() {
+			singleton->mutex.lock();
+			lock_depth++;
+		}
+		_FORCE_INLINE_ ~CacheLock() {
+			lock_depth--;
+			singleton->mutex.unlock();
+		}
+	};
+
+	static void _prefetch_parser_task(void *p_userdata, uint32_t p_index);
+	static void _gather_dependencies(GDScriptParser *p_parser, HashSet<String> &r_visited, LocalVector<String> &r_pending);
 
 public:
 	static void move_script(const String &p_from, const String &p_to);
@@ -103,6 +122,7 @@ public:
 	static Ref<GDScriptParserRef> get_parser(const String &p_path, GDScriptParserRef::Status status, Error &r_error, const String &p_owner = String());
 	static bool has_parser(const String &p_path);
 	static void remove_parser(const String &p_path);
+	static void prefetch_dependencies(const String &p_path);
 	static String get_source_code(const String &p_path);
 	static Vector<uint8_t> get_binary_tokens(const String &p_path);
 	static Ref<GDScript> get_shallow_script(const String &p_path, Error &r_error, const String &p_owner = String());
@@ -32,6 +32,10 @@
 
 #include "gdscript.h"
 
+#include "scene/scene_string_names.h"
+
+SafeNumeric<uint64_t> GDScriptFunction::inline_cache_version;
+
 Variant GDScriptFunction::get_constant(int p_idx) const {
 	ERR_FAIL_INDEX_V(p_idx, constants.size(), "<errconst>");
 	return constants[p_idx];
@@ -104,6 +108,96 @@ void GDScriptFunction::debug_get_stack_member_state(int p_line, List<Pair<String
 	}
 }
 
+GDScriptFunction::InlineCache *GDScriptFunction::_publish_inline_cache(int p_cache_index, InlineCache *p_old_cache, const InlineCache &p_cache) {
+	InlineCache *new_cache = memnew(InlineCache(p_cache));
+	new_cache->entries = p_old_cache ? p_old_cache->entries + 1 : 1;
+	new_cache->previous = p_old_cache;
+	if (!_inline_caches_ptr[p_cache_index].compare_exchange_strong(p_old_cache, new_cache, std::memory_order_acq_rel)) {
+		// Another thread updated the cache first.
+		memdelete(new_cache);
+		return nullptr;
+	}
+	return new_cache;
+}
+
+GDScriptFunction::InlineCache *GDScriptFunction::_update_call_cache(int p_cache_index, Object *p_base, const StringName &p_method) {
+	InlineCache *old_cache = _inline_caches_ptr[p_cache_index].load(std::memory_order_acquire);
+	uint64_t version = inline_cache_version.get();
+	int fills = (old_cache && old_cache->version == version) ? old_cache->fills + 1 : 1;
+	if (fills > MAX_INLINE_CACHE_FILLS || (old_cache && old_cache->entries >= MAX_INLINE_CACHE_ENTRIES)) {
+		return nullptr;
+	}
+
+	InlineCache cache;
+	cache.version = version;
+	cache.fills = fills;
+	cache.native_class = &p_base->get_class_name();
+
+	ScriptInstance *script_instance = p_base->get_script_instance();
+	if (script_instance) {
+		if (script_instance->is_placeholder() || script_instance->get_language() != GDScriptLanguage::get_singleton()) {
+			return nullptr;
+		}
+		const GDScript *script = static_cast<GDScriptInstance *>(script_instance)->script.ptr();
+		for (const GDScript *sptr = script; sptr; sptr = sptr->_base) {
+			if (!sptr->valid) {
+				return nullptr; // Will be recompiled, which invalidates the caches.
+			}
+			HashMap<StringName, GDScriptFunction *>::ConstIterator E = sptr->member_functions.find(p_method);
+			if (E) {
+				cache.function = E->value;
+				break;
+			}
+		}
+		cache.script = script;
+	}
+
+	if (p_method == CoreStringName(free_)) {
+		cache.miss = true; // Handled by `Object::callp()` itself.
+	} else if (script_instance && p_method == SceneStringName(_ready)) {
+		cache.miss = true; // Needs the implicit ready calls done by `GDScriptInstance::callp()`.
+	} else if (!cache.function) {
+		// Native method, of the object the script is attached to if any.
+		cache.method = ClassDB::get_method(*cache.native_class, p_method);
+		cache.miss = !cache.method;
+	}
+	if (cache.miss) {
+		cache.function = nullptr;
+		cache.method = nullptr;
+	}
+
+	return _publish_inline_cache(p_cache_index, old_cache, cache);
+}
+
+GDScriptFunction::InlineCache *GDScriptFunction::_update_member_cache(int p_cache_index, Object *p_base, const StringName &p_member) {
+	InlineCache *old_cache = _inline_caches_ptr[p_cache_index].load(std::memory_order_acquire);
+	uint64_t version = inline_cache_version.get();
+	int fills = (old_cache && old_cache->version == version) ? old_cache->fills + 1 : 1;
+	if (fills > MAX_INLINE_CACHE_FILLS || (old_cache && old_cache->entries >= MAX_INLINE_CACHE_ENTRIES)) {
+		return nullptr;
+	}
+
+	ScriptInstance *script_instance = p_base->get_script_instance();
+	if (!script_instance || script_instance->is_placeholder() || script_instance->get_language() != GDScriptLanguage::get_singleton()) {
+		return nullptr;
+	}
+
+	InlineCache cache;
+	cache.version = version;
+	cache.fills = fills;
+	cache.script = static_cast<GDScriptInstance *>(script_instance)->script.ptr();
+
+	// Only plain script members are cached, properties with getters and native properties go through `Object::get()`.
+	HashMap<StringName, GDScript::MemberInfo>::ConstIterator E = cache.script->member_indices.find(p_member);
+	if (E && E->value.getter == StringName()) {
+		cache.member_index = E->value.index;
+	} else {
+		cache.miss = true;
+	}
+
+	return _publish_inline_cache(p_cache_index, old_cache, cache);
+}
+
 GDScriptFunction::GDScriptFunction() {
 	name = "<anonymous>";
 #ifdef DEBUG_ENABLED
@@ -117,6 +211,20 @@ GDScriptFunction::GDScriptFunction() {
 GDScriptFunction::~GDScriptFunction() {
 	get_script()->member_functions.erase(name);
 
+	// Other functions may have this one cached.
+	invalidate_inline_caches();
+	for (int i = 0; i < _inline_caches_count; i++) {
+		InlineCache *cache = _inline_caches_ptr[i].load(std::memory_order_acquire);
+		while (cache) {
+			InlineCache *previous = cache->previous;
+			memdelete(cache);
+			cache = previous;
+		}
+	}
+	if (_inline_caches_ptr) {
+		memdelete_arr(_inline_caches_ptr);
+	}
+
 	for (int i = 0; i < lambdas.size(); i++) {
 		memdelete(lambdas[i]);
 	}
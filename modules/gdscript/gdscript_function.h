@@ -38,6 +38,7 @@
 #include "core/os/thread.h"
 #include "core/string/string_name.h"
 #include "core/templates/pair.h"
+#include "core/templates/safe_refcount.h"
 #include "core/templates/self_list.h"
 #include "core/variant/variant.h"
 
@@ -218,6 +219,14 @@ public:
 	enum Opcode {
 		OPCODE_OPERATOR,
 		OPCODE_OPERATOR_VALIDATED,
+		OPCODE_OPERATOR_VALIDATED_ASSIGN,
+		OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT,
+		OPCODE_OPERATOR_INT,
+		OPCODE_OPERATOR_INT_ASSIGN,
+		OPCODE_OPERATOR_INT_JUMP_IF_NOT,
+		OPCODE_OPERATOR_FLOAT,
+		OPCODE_OPERATOR_FLOAT_ASSIGN,
+		OPCODE_OPERATOR_FLOAT_JUMP_IF_NOT,
 		OPCODE_TYPE_TEST_BUILTIN,
 		OPCODE_TYPE_TEST_ARRAY,
 		OPCODE_TYPE_TEST_NATIVE,
@@ -509,6 +518,35 @@ private:
 	} profile;
 #endif
 
+	// Inline caches for untyped member accesses and calls (`OPCODE_GET_NAMED` and `OPCODE_CALL`),
+	// keyed by the receiver's native class or GDScript. Entries are immutable once published and
+	// are replaced as a whole when the receiver changes, so threads can read them without locking.
+	// A `miss` entry records that the lookup failed for that receiver, which then takes the generic path directly.
+	struct InlineCache {
+		uint64_t version = 0;
+		const StringName *native_class = nullptr;
+		MethodBind *method = nullptr;
+		const GDScript *script = nullptr;
+		GDScriptFunction *function = nullptr;
+		int member_index = -1;
+		bool miss = false;
+		int fills = 0;
+		int entries = 0; // Entries allocated for the call site so far, including this one.
+		InlineCache *previous = nullptr; // Replaced entries stay alive until the function is freed.
+	};
+	static constexpr int MAX_INLINE_CACHE_FILLS = 4; // Past this the call site is considered megamorphic.
+	static constexpr int MAX_INLINE_CACHE_ENTRIES = 16; // Past this the call site stops caching, bounding the replaced entries kept alive.
+	static SafeNumeric<uint64_t> inline_cache_version;
+
+	int _inline_caches_count = 0;
+	std::atomic<InlineCache *> *_inline_caches_ptr = nullptr;
+
+	InlineCache *_publish_inline_cache(int p_cache_index, InlineCache *p_old_cache, const InlineCache &p_cache);
+	InlineCache *_update_call_cache(int p_cache_index, Object *p_base, const StringName &p_method);
+	InlineCache *_update_member_cache(int p_cache_index, Object *p_base, const StringName &p_member);
+	_FORCE_INLINE_ void _call_with_cache(int p_cache_index, Variant *p_base, const StringName &p_method, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_err);
+	_FORCE_INLINE_ bool _get_named_with_cache(int p_cache_index, const Variant *p_base, const StringName &p_member, Variant &r_ret);
+
 	_FORCE_INLINE_ String _get_call_error(const Callable::CallError &p_err, const String &p_where, const Variant **argptrs) const;
 	Variant _get_default_variant_for_data_type(const GDScriptDataType &p_data_type);
 
@@ -544,6 +582,8 @@ public:
 	StringName get_global_name(int p_idx) const;
 
 	Variant call(GDScriptInstance *p_instance, const Variant **p_args, int p_argcount, Callable::CallError &r_err, CallState *p_state = nullptr);
+	// Drops the inline caches of every function, needed whenever functions or method binds they may point to are freed.
+	static void invalidate_inline_caches() { inline_cache_version.increment(); }
 	void debug_get_stack_member_state(int p_line, List<Pair<StringName, int>> *r_stackvars) const;
 
 #ifdef DEBUG_ENABLED
@@ -742,6 +742,17 @@ const HashMap<String, Ref<GDScriptParserRef>> &GDScriptParser::get_depended_pars
 	return depended_parsers;
 }
 
+void GDScriptParser::add_referenced_path(const String &p_path) {
+	if (p_path.is_empty()) {
+		return;
+	}
+	if (p_path.is_relative_path()) {
+		referenced_paths.insert(script_path.get_base_dir().path_join(p_path).simplify_path());
+	} else {
+		referenced_paths.insert(p_path.simplify_path());
+	}
+}
+
 GDScriptParser::ClassNode *GDScriptParser::find_class(const String &p_qualified_name) const {
 	String first = p_qualified_name.get_slice("::", 0);
 
@@ -867,6 +878,7 @@ void GDScriptParser::parse_extends() {
 			push_error(vformat(R"(Only strings or identifiers can be used after "extends", found "%s" instead.)", Variant::get_type_name(previous.literal.get_type())));
 		}
 		current_class->extends_path = previous.literal;
+		add_referenced_path(current_class->extends_path);
 
 		if (!match(GDScriptTokenizer::Token::PERIOD)) {
 			return;
@@ -879,6 +891,7 @@ void GDScriptParser::parse_extends() {
 		return;
 	}
 	current_class->extends.push_back(parse_identifier());
+	referenced_names.insert(current_class->extends[0]->name);
 
 	while (match(GDScriptTokenizer::Token::PERIOD)) {
 		make_completion_context(COMPLETION_INHERIT_TYPE, current_class, chain_index++);
@@ -3345,6 +3358,8 @@ GDScriptParser::ExpressionNode *GDScriptParser::parse_preload(ExpressionNode *p_
 
 	if (preload->path == nullptr) {
 		push_error(R"(Expected resource path after "(".)");
+	} else if (preload->path->type == Node::LITERAL && static_cast<LiteralNode *>(preload->path)->value.get_type() == Variant::STRING) {
+		add_referenced_path(static_cast<LiteralNode *>(preload->path)->value);
 	}
 
 	pop_completion_call();
@@ -3523,6 +3538,7 @@ GDScriptParser::TypeNode *GDScriptParser::parse_type(bool p_allow_void) {
 	IdentifierNode *type_element = parse_identifier();
 
 	type->type_chain.push_back(type_element);
+	referenced_names.insert(type_element->name);
 
 	if (match(GDScriptTokenizer::Token::BRACKET_OPEN)) {
 		// Typed collection (like Array[int]).
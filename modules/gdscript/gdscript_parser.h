@@ -44,6 +44,7 @@
 #include "core/string/string_name.h"
 #include "core/string/ustring.h"
 #include "core/templates/hash_map.h"
+#include "core/templates/hash_set.h"
 #include "core/templates/list.h"
 #include "core/templates/rb_map.h"
 #include "core/templates/vector.h"
@@ -1335,6 +1336,10 @@ private:
 	bool can_continue = false;
 	List<bool> multiline_stack;
 	HashMap<String, Ref<GDScriptParserRef>> depended_parsers;
+	// Scripts referenced by literal path (`extends "..."`, `preload("...")`) or by name
+	// (`extends` and type specifiers), so the cache can parse them ahead of the analyzer.
+	HashSet<String> referenced_paths;
+	HashSet<StringName> referenced_names;
 
 	ClassNode *head = nullptr;
 	Node *list = nullptr;
@@ -1479,6 +1484,7 @@ private:
 	ClassNode *parse_class(bool p_is_static);
 	void parse_class_name();
 	void parse_extends();
+	void add_referenced_path(const String &p_path);
 	void parse_class_body(bool p_is_multiline);
 	template <typename T>
 	void parse_class_member(T *(GDScriptParser::*p_parse_function)(bool), AnnotationInfo::TargetKind p_target, const String &p_member_kind, bool p_is_static = false);
@@ -1567,6 +1573,8 @@ public:
 	bool is_tool() const { return _is_tool; }
 	Ref<GDScriptParserRef> get_depended_parser_for(const String &p_path);
 	const HashMap<String, Ref<GDScriptParserRef>> &get_depended_parsers();
+	const HashSet<String> &get_referenced_paths() const { return referenced_paths; }
+	const HashSet<StringName> &get_referenced_names() const { return referenced_names; }
 	ClassNode *find_class(const String &p_qualified_name) const;
 	bool has_class(const GDScriptParser::ClassNode *p_class) const;
 	static Variant::Type get_builtin_type(const StringName &p_type); // Excluding `Variant::NIL` and `Variant::OBJECT`.
@@ -109,6 +109,113 @@ void GDScriptFunction::_profile_native_call(uint64_t p_t_taken, const String &p_
 
 #endif // DEBUG_ENABLED
 
+// Operators on analyzer-proven `int` and `float` operands, evaluated directly on the internal
+// storage of the stack slots. The destination is always a temporary already adjusted to the
+// result type, so no Variant is constructed or destroyed.
+template <typename T>
+static _FORCE_INLINE_ void _evaluate_numeric_operator(Variant::Operator p_operator, const Variant *p_a, const Variant *p_b, Variant *r_dst) {
+	const T a = *VariantGetInternalPtr<T>::get_ptr(p_a);
+	const T b = *VariantGetInternalPtr<T>::get_ptr(p_b);
+	switch (p_operator) {
+		case Variant::OP_ADD:
+			*VariantGetInternalPtr<T>::get_ptr(r_dst) = a + b;
+			break;
+		case Variant::OP_SUBTRACT:
+			*VariantGetInternalPtr<T>::get_ptr(r_dst) = a - b;
+			break;
+		case Variant::OP_MULTIPLY:
+			*VariantGetInternalPtr<T>::get_ptr(r_dst) = a * b;
+			break;
+		case Variant::OP_DIVIDE:
+			// Only emitted for floats, integer division needs the division by zero check.
+			*VariantGetInternalPtr<T>::get_ptr(r_dst) = a / b;
+			break;
+		case Variant::OP_EQUAL:
+			*VariantInternal::get_bool(r_dst) = a == b;
+			break;
+		case Variant::OP_NOT_EQUAL:
+			*VariantInternal::get_bool(r_dst) = a != b;
+			break;
+		case Variant::OP_LESS:
+			*VariantInternal::get_bool(r_dst) = a < b;
+			break;
+		case Variant::OP_LESS_EQUAL:
+			*VariantInternal::get_bool(r_dst) = a <= b;
+			break;
+		case Variant::OP_GREATER:
+			*VariantInternal::get_bool(r_dst) = a > b;
+			break;
+		case Variant::OP_GREATER_EQUAL:
+			*VariantInternal::get_bool(r_dst) = a >= b;
+			break;
+		default:
+			break; // Not emitted by the compiler.
+	}
+}
+
+void GDScriptFunction::_call_with_cache(int p_cache_index, Variant *p_base, const StringName &p_method, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_err) {
+	if (p_base->get_type() == Variant::OBJECT) {
+#ifdef DEBUG_ENABLED
+		Object *base_obj = p_base->get_validated_object();
+#else
+		Object *base_obj = p_base->operator Object *();
+#endif
+		if (base_obj) {
+			const InlineCache *cache = _inline_caches_ptr[p_cache_index].load(std::memory_order_acquire);
+			ScriptInstance *script_instance = base_obj->get_script_instance();
+			bool hit = false;
+			if (cache && cache->version == inline_cache_version.get()) {
+				if (script_instance) {
+					hit = cache->script && !script_instance->is_placeholder() && script_instance->get_language() == GDScriptLanguage::get_singleton() && static_cast<GDScriptInstance *>(script_instance)->script.ptr() == cache->script && (cache->function || cache->native_class == &base_obj->get_class_name());
+				} else {
+					hit = !cache->script && cache->native_class == &base_obj->get_class_name();
+				}
+			}
+			if (!hit) {
+				cache = _update_call_cache(p_cache_index, base_obj, p_method);
+			}
+			if (cache && !cache->miss) {
+#ifdef DEBUG_ENABLED
+				// Same as `Object::callp()`, the object can't be freed during the call.
+				_ObjectDebugLock debug_lock(base_obj);
+#endif
+				if (cache->function) {
+					r_ret = cache->function->call(static_cast<GDScriptInstance *>(script_instance), p_args, p_argcount, r_err);
+				} else {
+					r_ret = cache->method->call(base_obj, p_args, p_argcount, r_err);
+				}
+				return;
+			}
+		}
+	}
+	p_base->callp(p_method, p_args, p_argcount, r_ret, r_err);
+}
+
+bool GDScriptFunction::_get_named_with_cache(int p_cache_index, const Variant *p_base, const StringName &p_member, Variant &r_ret) {
+	if (p_base->get_type() == Variant::OBJECT) {
+#ifdef DEBUG_ENABLED
+		Object *base_obj = p_base->get_validated_object();
+#else
+		Object *base_obj = p_base->operator Object *();
+#endif
+		ScriptInstance *script_instance = base_obj ? base_obj->get_script_instance() : nullptr;
+		if (script_instance && !script_instance->is_placeholder() && script_instance->get_language() == GDScriptLanguage::get_singleton()) {
+			GDScriptInstance *instance = static_cast<GDScriptInstance *>(script_instance);
+			const InlineCache *cache = _inline_caches_ptr[p_cache_index].load(std::memory_order_acquire);
+			if (!cache || cache->version != inline_cache_version.get() || cache->script != instance->script.ptr()) {
+				cache = _update_member_cache(p_cache_index, base_obj, p_member);
+			}
+			if (cache && !cache->miss) {
+				r_ret = instance->members[cache->member_index];
+				return true;
+			}
+		}
+	}
+	bool valid;
+	r_ret = p_base->get_named(p_member, valid);
+	return valid;
+}
+
 Variant GDScriptFunction::_get_default_variant_for_data_type(const GDScriptDataType &p_data_type) {
 	if (p_data_type.kind == GDScriptDataType::BUILTIN) {
 		if (p_data_type.builtin_type == Variant::ARRAY) {
@@ -215,6 +322,14 @@ void (*type_init_function_table[])(Variant *) = {
 	static const void *switch_table_ops[] = {            \
 		&&OPCODE_OPERATOR,                               \
 		&&OPCODE_OPERATOR_VALIDATED,                     \
+		&&OPCODE_OPERATOR_VALIDATED_ASSIGN,              \
+		&&OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT,         \
+		&&OPCODE_OPERATOR_INT,                           \
+		&&OPCODE_OPERATOR_INT_ASSIGN,                    \
+		&&OPCODE_OPERATOR_INT_JUMP_IF_NOT,               \
+		&&OPCODE_OPERATOR_FLOAT,                         \
+		&&OPCODE_OPERATOR_FLOAT_ASSIGN,                  \
+		&&OPCODE_OPERATOR_FLOAT_JUMP_IF_NOT,             \
 		&&OPCODE_TYPE_TEST_BUILTIN,                      \
 		&&OPCODE_TYPE_TEST_ARRAY,                        \
 		&&OPCODE_TYPE_TEST_NATIVE,                       \
@@ -792,6 +907,160 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+			OPCODE(OPCODE_OPERATOR_VALIDATED_ASSIGN) {
+				CHECK_SPACE(6);
+
+				int operator_idx = _code_ptr[ip + 4];
+				GD_ERR_BREAK(operator_idx < 0 || operator_idx >= _operator_funcs_count);
+				Variant::ValidatedOperatorEvaluator operator_func = _operator_funcs_ptr[operator_idx];
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+				GET_VARIANT_PTR(target, 4);
+
+				operator_func(a, b, dst);
+				*target = *dst;
+
+				ip += 6;
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT) {
+				CHECK_SPACE(6);
+
+				int operator_idx = _code_ptr[ip + 4];
+				GD_ERR_BREAK(operator_idx < 0 || operator_idx >= _operator_funcs_count);
+				Variant::ValidatedOperatorEvaluator operator_func = _operator_funcs_ptr[operator_idx];
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				operator_func(a, b, dst);
+
+				if (!dst->booleanize()) {
+					int to = _code_ptr[ip + 5];
+					GD_ERR_BREAK(to < 0 || to > _code_size);
+					ip = to;
+				} else {
+					ip += 6;
+				}
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_OPERATOR_INT) {
+				CHECK_SPACE(5);
+
+				Variant::Operator op = (Variant::Operator)_code_ptr[ip + 4];
+				GD_ERR_BREAK(op >= Variant::OP_MAX);
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				_evaluate_numeric_operator<int64_t>(op, a, b, dst);
+
+				ip += 5;
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_OPERATOR_INT_ASSIGN) {
+				CHECK_SPACE(6);
+
+				Variant::Operator op = (Variant::Operator)_code_ptr[ip + 4];
+				GD_ERR_BREAK(op >= Variant::OP_MAX);
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+				GET_VARIANT_PTR(target, 4);
+
+				_evaluate_numeric_operator<int64_t>(op, a, b, dst);
+				*target = *dst;
+
+				ip += 6;
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_OPERATOR_INT_JUMP_IF_NOT) {
+				CHECK_SPACE(6);
+
+				Variant::Operator op = (Variant::Operator)_code_ptr[ip + 4];
+				GD_ERR_BREAK(op >= Variant::OP_MAX);
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				_evaluate_numeric_operator<int64_t>(op, a, b, dst);
+
+				if (!dst->booleanize()) {
+					int to = _code_ptr[ip + 5];
+					GD_ERR_BREAK(to < 0 || to > _code_size);
+					ip = to;
+				} else {
+					ip += 6;
+				}
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_OPERATOR_FLOAT) {
+				CHECK_SPACE(5);
+
+				Variant::Operator op = (Variant::Operator)_code_ptr[ip + 4];
+				GD_ERR_BREAK(op >= Variant::OP_MAX);
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				_evaluate_numeric_operator<double>(op, a, b, dst);
+
+				ip += 5;
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_OPERATOR_FLOAT_ASSIGN) {
+				CHECK_SPACE(6);
+
+				Variant::Operator op = (Variant::Operator)_code_ptr[ip + 4];
+				GD_ERR_BREAK(op >= Variant::OP_MAX);
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+				GET_VARIANT_PTR(target, 4);
+
+				_evaluate_numeric_operator<double>(op, a, b, dst);
+				*target = *dst;
+
+				ip += 6;
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_OPERATOR_FLOAT_JUMP_IF_NOT) {
+				CHECK_SPACE(6);
+
+				Variant::Operator op = (Variant::Operator)_code_ptr[ip + 4];
+				GD_ERR_BREAK(op >= Variant::OP_MAX);
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				_evaluate_numeric_operator<double>(op, a, b, dst);
+
+				if (!dst->booleanize()) {
+					int to = _code_ptr[ip + 5];
+					GD_ERR_BREAK(to < 0 || to > _code_size);
+					ip = to;
+				} else {
+					ip += 6;
+				}
+			}
+			DISPATCH_OPCODE;
+
 			OPCODE(OPCODE_TYPE_TEST_BUILTIN) {
 				CHECK_SPACE(4);
 
@@ -1158,7 +1427,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			DISPATCH_OPCODE;
 
 			OPCODE(OPCODE_GET_NAMED) {
-				CHECK_SPACE(4);
+				CHECK_SPACE(5);
 
 				GET_VARIANT_PTR(src, 0);
 				GET_VARIANT_PTR(dst, 1);
@@ -1168,22 +1437,22 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
-				bool valid;
-#ifdef DEBUG_ENABLED
-				//allow better error message in cases where src and dst are the same stack position
-				Variant ret = src->get_named(*index, valid);
+				int cache_index = _code_ptr[ip + 4];
+				GD_ERR_BREAK(cache_index < 0 || cache_index >= _inline_caches_count);
 
-#else
-				*dst = src->get_named(*index, valid);
-#endif
+				// Get into a temporary first, src and dst may be the same stack position.
+				Variant ret;
 #ifdef DEBUG_ENABLED
+				bool valid = _get_named_with_cache(cache_index, src, *index, ret);
 				if (!valid) {
 					err_text = "Invalid access to property or key '" + index->operator String() + "' on a base object of type '" + _get_var_type(src) + "'.";
 					OPCODE_BREAK;
 				}
-				*dst = ret;
+#else
+				_get_named_with_cache(cache_index, src, *index, ret);
 #endif
-				ip += 4;
+				*dst = ret;
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
@@ -1719,7 +1988,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				bool call_async = (_code_ptr[ip]) == OPCODE_CALL_ASYNC;
 #endif
 				LOAD_INSTRUCTION_ARGS
-				CHECK_SPACE(3 + instr_arg_count);
+				CHECK_SPACE(4 + instr_arg_count);
 
 				ip += instr_arg_count;
 
@@ -1730,6 +1999,9 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(methodname_idx < 0 || methodname_idx >= _global_names_count);
 				const StringName *methodname = &_global_names_ptr[methodname_idx];
 
+				int cache_index = _code_ptr[ip + 3];
+				GD_ERR_BREAK(cache_index < 0 || cache_index >= _inline_caches_count);
+
 				GET_INSTRUCTION_ARG(base, argc);
 				Variant **argptrs = instruction_args;
 
@@ -1747,7 +2019,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				Callable::CallError err;
 				if (call_ret) {
 					GET_INSTRUCTION_ARG(ret, argc + 1);
-					base->callp(*methodname, (const Variant **)argptrs, argc, *ret, err);
+					_call_with_cache(cache_index, base, *methodname, (const Variant **)argptrs, argc, *ret, err);
 #ifdef DEBUG_ENABLED
 					if (ret->get_type() == Variant::NIL) {
 						if (base_type == Variant::OBJECT) {
@@ -1777,7 +2049,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 #endif
 				} else {
 					Variant ret;
-					base->callp(*methodname, (const Variant **)argptrs, argc, ret, err);
+					_call_with_cache(cache_index, base, *methodname, (const Variant **)argptrs, argc, ret, err);
 				}
 #ifdef DEBUG_ENABLED
 
@@ -1827,7 +2099,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				}
 #endif
 
-				ip += 3;
+				ip += 4;
 			}
 			DISPATCH_OPCODE;
 
@@ -3612,6 +3884,10 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 						GDScriptLanguage::get_singleton()->debug_break("Breakpoint", true);
 					}
 
+#ifdef DEBUG_ENABLED
+					GDScriptLanguage::get_singleton()->sample_poll();
+#endif
+
 					EngineDebugger::get_singleton()->line_poll();
 				}
 			}
@@ -33,8 +33,73 @@
 
 #include "gdscript_test_runner.h"
 
+#include "../gdscript_cache.h"
+
+#include "core/io/dir_access.h"
+#include "core/os/thread.h"
+
 #include "tests/test_macros.h"
 
+#ifdef DEBUG_ENABLED
+// Drives the sampling profiler by hand, with a fake call stack and a fake timer.
+class TestGDScriptSamplingAccessor {
+	GDScriptLanguage *lang = GDScriptLanguage::get_singleton();
+	int line = 0;
+
+public:
+	void start() {
+		MutexLock lock(lang->sampling_mutex);
+		lang->sampled_lines.clear();
+		lang->sampled_stacks.clear();
+		lang->sampling_start_usec.set(0);
+		GDScriptLanguage::_call_stack.sample_clock_usec = 0;
+		lang->sampling.set();
+	}
+
+	void stop() {
+		lang->sampling.clear();
+	}
+
+	// Enters the outermost call, returns the time the thread resynchronized to.
+	uint64_t enter(int p_line) {
+		GDScriptLanguage::CallStack &cs = GDScriptLanguage::_call_stack;
+		if (cs.levels == nullptr) {
+			cs.levels = memnew_arr(GDScriptLanguage::CallLevel, lang->_debug_max_call_stack + 1);
+		}
+		REQUIRE(cs.stack_pos == 0);
+		lang->_sample_resync();
+		line = p_line;
+		cs.levels[0] = GDScriptLanguage::CallLevel();
+		cs.levels[0].line = &line;
+		cs.stack_pos = 1;
+		return cs.sample_clock_usec;
+	}
+
+	void exit() {
+		GDScriptLanguage::_call_stack.stack_pos = 0;
+	}
+
+	void set_line(int p_line) {
+		line = p_line;
+	}
+
+	void tick(uint64_t p_clock_usec) {
+		GDScriptLanguage::sampling_clock_usec.set(p_clock_usec);
+		GDScriptLanguage::sampling_epoch.increment();
+	}
+
+	void poll() {
+		lang->sample_poll();
+	}
+
+	uint64_t get_line_weight(int p_line) {
+		MutexLock lock(lang->sampling_mutex);
+		const uint64_t *weight = lang->sampled_lines.getptr("<unknown>:" + itos(p_line));
+		return weight ? *weight : 0;
+	}
+};
+#endif // DEBUG_ENABLED
+
 namespace GDScriptTests {
 
 // TODO: Handle some cases failing on release builds. See: https://github.com/godotengine/godot/pull/88452
@@ -70,8 +135,110 @@ func _init():
 	ref_counted->set_script(gdscript);
 	CHECK_MESSAGE(int(ref_counted->get_meta("result")) == 42, "The script should assign object metadata successfully.");
 }
+
+struct PrefetchData {
+	String main_path;
+	Vector<String> paths;
+	LocalVector<bool> prefetched;
+	Ref<GDScript> script;
+};
+
+static void prefetch_and_load_script(void *p_userdata) {
+	PrefetchData *data = static_cast<PrefetchData *>(p_userdata);
+	GDScriptCache::prefetch_dependencies(data->main_path);
+	// Everything is already registered the second time, so nothing is parsed again.
+	GDScriptCache::prefetch_dependencies(data->main_path);
+	for (const String &path : data->paths) {
+		data->prefetched.push_back(GDScriptCache::has_parser(path));
+	}
+	Error err = OK;
+	data->script = GDScriptCache::get_full_script(data->main_path, err);
+}
+
+TEST_CASE("[Modules][GDScript] Prefetch the dependencies of a script loaded on a thread") {
+	const String dir = TestUtils::get_temp_path("gdscript_prefetch");
+	Ref<DirAccess> da = DirAccess::create(DirAccess::ACCESS_FILESYSTEM);
+	REQUIRE(da->make_dir_recursive(dir) == OK);
+
+	// dep_c.gd also depends on dep_a.gd, which must only be parsed once.
+	const char *dependencies[3][2] = {
+		{ "dep_a.gd", "extends RefCounted\nconst VALUE = 1\n" },
+		{ "dep_b.gd", "extends RefCounted\nconst VALUE = 2\n" },
+		{ "dep_c.gd", "extends RefCounted\nconst A = preload(\"dep_a.gd\")\nconst VALUE = A.VALUE + 2\n" },
+	};
+	for (int i = 0; i < 3; i++) {
+		Ref<FileAccess> f = FileAccess::open(dir.path_join(dependencies[i][0]), FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_string(dependencies[i][1]);
+	}
+	const String main_path = dir.path_join("main.gd");
+	{
+		Ref<FileAccess> f = FileAccess::open(main_path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_string("extends RefCounted\nconst A = preload(\"dep_a.gd\")\nconst B = preload(\"dep_b.gd\")\nconst C = preload(\"dep_c.gd\")\n\nfunc get_total():\n\treturn A.VALUE + B.VALUE + C.VALUE\n");
+	}
+
+	PrefetchData data;
+	data.main_path = main_path;
+	data.paths.push_back(main_path);
+	for (int i = 0; i < 3; i++) {
+		data.paths.push_back(dir.path_join(dependencies[i][0]));
+	}
+	Thread thread;
+	thread.start(prefetch_and_load_script, &data);
+	thread.wait_to_finish();
+
+	REQUIRE(data.prefetched.size() == (uint32_t)data.paths.size());
+	for (int i = 0; i < data.paths.size(); i++) {
+		CHECK_MESSAGE(data.prefetched[i], vformat("\"%s\" should have been parsed ahead of time.", data.paths[i]));
+	}
+	REQUIRE(data.script.is_valid());
+	for (int i = 1; i < data.paths.size(); i++) {
+		CHECK_MESSAGE(GDScriptCache::get_cached_script(data.paths[i]).is_valid(), vformat("Dependency \"%s\" should be loaded.", data.paths[i]));
+	}
+
+	Ref<RefCounted> ref_counted = memnew(RefCounted);
+	ref_counted->set_script(data.script);
+	CHECK(int(ref_counted->call("get_total")) == 6);
+
+	ref_counted.unref();
+	data.script.unref();
+	for (int i = 0; i < 3; i++) {
+		da->remove(dir.path_join(dependencies[i][0]));
+	}
+	da->remove(main_path);
+}
 #endif // TOOLS_ENABLED
 
+#ifdef DEBUG_ENABLED
+TEST_CASE("[Modules][GDScript] Weight profiler samples by the time since the previous one") {
+	TestGDScriptSamplingAccessor sampler;
+	sampler.start();
+
+	// Time spent before entering a script is not charged to its first line.
+	OS::get_singleton()->delay_usec(2000);
+	const uint64_t entered_usec = sampler.enter(1);
+	sampler.tick(entered_usec + 700);
+	sampler.poll();
+	CHECK(sampler.get_line_weight(1) == 700);
+
+	// Epochs that pass without a poll, e.g. in native code, are charged to the next line.
+	sampler.set_line(2);
+	sampler.tick(entered_usec + 1700);
+	sampler.tick(entered_usec + 2700);
+	sampler.tick(entered_usec + 3700);
+	sampler.poll();
+	CHECK(sampler.get_line_weight(2) == 3000);
+
+	// Nothing more is charged until the epoch changes again.
+	sampler.poll();
+	CHECK(sampler.get_line_weight(2) == 3000);
+
+	sampler.exit();
+	sampler.stop();
+}
+#endif // DEBUG_ENABLED
+
 TEST_CASE("[Modules][GDScript] Validate built-in API") {
 	GDScriptLanguage *lang = GDScriptLanguage::get_singleton();
 
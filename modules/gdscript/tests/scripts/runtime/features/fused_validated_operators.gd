@@ -0,0 +1,33 @@
+# Typed operators followed by a jump or an assignment are fused into a single instruction.
+
+var member: int = 1
+
+func test():
+	var total: int = 0
+	var i: int = 0
+	while i < 5:
+		total += i
+		i += 1
+	print(total)
+
+	var f: float = 0.5
+	if f > 0.25 and f < 1.0:
+		print("in range")
+	if f >= 1.0:
+		print("not reached")
+	else:
+		print("else branch")
+
+	var v := Vector2(1, 2)
+	v += Vector2(3, 4)
+	print(v)
+
+	var label := "big" if i * 2 > 8 else "small"
+	print(label)
+
+	member += 41
+	print(member)
+
+	for j: int in 3:
+		if j % 2 == 0:
+			print(j)
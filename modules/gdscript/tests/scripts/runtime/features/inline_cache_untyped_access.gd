@@ -0,0 +1,53 @@
+# Untyped calls and member accesses cache their lookup per call site.
+# The cache must follow the receiver when it changes.
+
+class A:
+	var value = 1
+	func get_name_str():
+		return "A"
+
+class B extends A:
+	var extra = 0
+	func get_name_str():
+		return "B"
+
+class C:
+	var other = "first"
+	var value = 3
+
+class D:
+	var counter = 0
+	var value:
+		get:
+			counter += 1
+			return counter * 10
+
+func describe(obj):
+	return "%s %s" % [obj.get_name_str(), obj.value]
+
+func test():
+	var receivers = [A.new(), A.new(), B.new(), A.new(), B.new()]
+	for obj in receivers:
+		print(describe(obj))
+
+	# Same member name at a different index in another script.
+	var values = []
+	for obj in [A.new(), C.new(), A.new()]:
+		values.append(obj.value)
+	print(values)
+
+	# Native methods, with and without a script attached.
+	var names = []
+	for obj in [RefCounted.new(), Node.new(), A.new()]:
+		names.append(obj.get_class())
+		if obj is Node:
+			obj.free()
+	print(names)
+
+	# A property with a getter is never a plain member. The failed lookup is cached
+	# but every access must still run the getter.
+	var d = D.new()
+	var getter_values = []
+	for obj in [d, d, A.new(), d]:
+		getter_values.append(obj.value)
+	print(getter_values)
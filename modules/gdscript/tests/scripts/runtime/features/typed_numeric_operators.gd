@@ -0,0 +1,37 @@
+# Operators on statically typed `int` and `float` values skip the Variant evaluators.
+
+func fib(n: int) -> int:
+	var a: int = 0
+	var b: int = 1
+	var i: int = 0
+	while i < n:
+		var next: int = a + b
+		a = b
+		b = next
+		i += 1
+	return a
+
+func test():
+	print(fib(30))
+
+	var big: int = 9223372036854775807
+	print(big - 1 == 9223372036854775806)
+
+	var x: float = 1.5
+	var y: float = 0.5
+	print(x + y)
+	print(x - y)
+	print(x * y)
+	print(x / y)
+	print(x != y, x == y)
+	print(x <= 1.5, x < 1.5, x >= 1.5, x > 1.5)
+
+	var sum: float = 0.0
+	for k: int in 4:
+		if k >= 0:
+			sum += 0.25
+	print(sum)
+
+	# Mixed operands keep using the generic validated evaluators.
+	var mixed := x * 2
+	print(mixed)
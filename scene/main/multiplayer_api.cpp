@@ -62,6 +62,7 @@ Ref<MultiplayerAPI> MultiplayerAPI::create_default_interface() {
 // - The first LSB 6 bits are used for the variant type.
 // - The next two bits are used to store the encoding mode.
 // - Boolean values uses the encoding mode to store the value.
+// - Strings and containers use ENCODE_COMPACT when followed by encode_variant_compact() data.
 #define VARIANT_META_TYPE_MASK 0x3F
 #define VARIANT_META_EMODE_MASK 0xC0
 #define VARIANT_META_BOOL_MASK 0x80
@@ -69,6 +70,7 @@ Ref<MultiplayerAPI> MultiplayerAPI::create_default_interface() {
 #define ENCODE_16 1 << 6
 #define ENCODE_32 2 << 6
 #define ENCODE_64 3 << 6
+#define ENCODE_COMPACT 1 << 6
 Error MultiplayerAPI::encode_and_compress_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bool p_allow_object_decoding) {
 	// Unreachable because `VARIANT_MAX` == 38 and `ENCODE_VARIANT_MASK` == 77
 	CRASH_COND(p_variant.get_type() > VARIANT_META_TYPE_MASK);
@@ -128,6 +130,22 @@ Error MultiplayerAPI::encode_and_compress_variant(const Variant &p_variant, uint
 				buf[0] = encode_mode | p_variant.get_type();
 			}
 		} break;
+		case Variant::STRING:
+		case Variant::STRING_NAME:
+		case Variant::ARRAY:
+		case Variant::DICTIONARY: {
+			if (buf) {
+				// Reserve the first byte for the meta.
+				buf[0] = ENCODE_COMPACT | p_variant.get_type();
+				buf += 1;
+			}
+			int len;
+			Error err = encode_variant_compact(p_variant, buf, len, Variant(), p_allow_object_decoding);
+			if (err != OK) {
+				return err;
+			}
+			r_len += 1 + len;
+		} break;
 		default:
 			// Any other case is not yet compressed.
 			Error err = encode_variant(p_variant, r_buffer, r_len, p_allow_object_decoding);
@@ -202,6 +220,26 @@ Error MultiplayerAPI::decode_and_decompress_variant(Variant &r_variant, const ui
 				}
 			}
 		} break;
+		case Variant::STRING:
+		case Variant::STRING_NAME:
+		case Variant::ARRAY:
+		case Variant::DICTIONARY: {
+			if (encode_mode == ENCODE_COMPACT) {
+				int len;
+				Error err = decode_variant_compact(r_variant, p_buffer + 1, p_len - 1, &len, Variant(), p_allow_object_decoding);
+				if (err != OK) {
+					return err;
+				}
+				if (r_len) {
+					*r_len = 1 + len;
+				}
+				break;
+			}
+			Error err = decode_variant(r_variant, p_buffer, p_len, r_len, p_allow_object_decoding);
+			if (err != OK) {
+				return err;
+			}
+		} break;
 		default:
 			Error err = decode_variant(r_variant, p_buffer, p_len, r_len, p_allow_object_decoding);
 			if (err != OK) {
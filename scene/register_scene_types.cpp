@@ -342,6 +342,9 @@ void register_scene_types() {
 
 	resource_loader_text.instantiate();
 	ResourceLoader::add_resource_format_loader(resource_loader_text, true);
+#ifdef DEBUG_ENABLED
+	ResourceFormatLoaderText::set_binary_cache_enabled(GLOBAL_DEF("debug/settings/resources/text_resource_binary_cache", false));
+#endif
 
 	resource_saver_shader.instantiate();
 	ResourceSaver::add_resource_format_saver(resource_saver_shader, true);
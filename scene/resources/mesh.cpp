@@ -1994,6 +1994,23 @@ RID ArrayMesh::get_rid() const {
 	return mesh;
 }
 
+uint64_t ArrayMesh::get_memory_usage_estimate() const {
+	uint64_t size = Mesh::get_memory_usage_estimate();
+	for (const Surface &surface : surfaces) {
+		// Blend shapes store their own copy of positions, normals and tangents.
+		uint64_t shape_stride = RS::get_singleton()->mesh_surface_get_format_vertex_stride(surface.format, surface.array_length) +
+				RS::get_singleton()->mesh_surface_get_format_normal_tangent_stride(surface.format, surface.array_length);
+		uint64_t stride = shape_stride +
+				RS::get_singleton()->mesh_surface_get_format_attribute_stride(surface.format, surface.array_length) +
+				RS::get_singleton()->mesh_surface_get_format_skin_stride(surface.format, surface.array_length);
+		size += (stride + shape_stride * blend_shapes.size()) * surface.array_length;
+		if (surface.index_array_length > 0) {
+			size += uint64_t(surface.index_array_length) * (surface.array_length <= (1 << 16) ? 2 : 4);
+		}
+	}
+	return size;
+}
+
 AABB ArrayMesh::get_aabb() const {
 	return aabb;
 }
@@ -165,8 +165,15 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 
 	LocalVector<DeferredNodePathProperties> deferred_node_paths;
 
+	// The editor needs the full treatment, as classes and properties may be in flux there.
+	const InstantiationPlan *plan = nullptr;
+	if (p_edit_state == GEN_EDIT_STATE_DISABLED && !Engine::get_singleton()->is_editor_hint()) {
+		plan = &_get_instantiation_plan();
+	}
+
 	for (int i = 0; i < nc; i++) {
 		const NodeData &n = nd[i];
+		const InstantiationPlan::NodePlan *node_plan = nullptr;
 
 		Node *parent = nullptr;
 		String old_parent_path;
@@ -257,7 +264,11 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 			}
 		} else {
 			// Node belongs to this scene and must be created.
-			Object *obj = ClassDB::instantiate(snames[n.type]);
+			Object *obj = nullptr;
+			obj = ClassDB::instantiate(snames[n.type]);
+			if (plan && plan->nodes[i].planned && obj && obj->get_class_name() == snames[n.type]) {
+				node_plan = &plan->nodes[i];
+			}
 
 			node = Object::cast_to<Node>(obj);
 
@@ -267,6 +278,8 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 					obj = nullptr;
 				}
 
+				node_plan = nullptr;
+
 				if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
 					missing_node = memnew(MissingNode);
 					missing_node->set_original_class(snames[n.type]);
@@ -415,7 +428,22 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 						}
 
 						if (set_valid) {
-							node->set(snames[nprops[j].name], value, &valid);
+							const InstantiationPlan::Setter *setter = node_plan ? &node_plan->setters[j] : nullptr;
+							if (setter && setter->method && !node->get_script_instance()) {
+								// What Object::set() would end up doing for a bound property.
+								Callable::CallError ce;
+								if (setter->index >= 0) {
+									Variant index = setter->index;
+									const Variant *args[2] = { &index, &value };
+									setter->method->call(node, args, 2, ce);
+								} else {
+									const Variant *arg = &value;
+									setter->method->call(node, &arg, 1, ce);
+								}
+								valid = ce.error == Callable::CallError::CALL_OK;
+							} else {
+								node->set(snames[nprops[j].name], value, &valid);
+							}
 						}
 						if (p_edit_state == GEN_EDIT_STATE_INSTANCE && value.get_type() != Variant::OBJECT) {
 							value = value.duplicate(true); // Duplicate arrays and dictionaries for the editor.
@@ -572,7 +600,9 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 			callable = callable.unbind(c.unbinds);
 		} else if (!c.binds.is_empty()) {
 			Vector<Variant> binds;
-			if (c.binds.size()) {
+			if (plan) {
+				binds = plan->connection_binds[i];
+			} else {
 				binds.resize(c.binds.size());
 				for (int j = 0; j < c.binds.size(); j++) {
 					binds.write[j] = props[c.binds[j]];
@@ -607,6 +637,67 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 	return ret_nodes[0];
 }
 
+const SceneState::InstantiationPlan &SceneState::_get_instantiation_plan() const {
+	if (instantiation_plan_built.is_set()) {
+		return instantiation_plan;
+	}
+
+	MutexLock lock(instantiation_plan_mutex);
+	if (instantiation_plan_built.is_set()) {
+		return instantiation_plan;
+	}
+
+	instantiation_plan.nodes.resize(nodes.size());
+	for (int i = 0; i < nodes.size(); i++) {
+		const NodeData &n = nodes[i];
+		if ((i == 0 && base_scene_idx >= 0) || n.instance >= 0 || n.type == TYPE_INSTANTIATED || n.type < 0 || n.type >= names.size()) {
+			continue;
+		}
+
+		// Anything but plain engine classes is left to Object::set(), which knows how to deal with it.
+		const StringName &class_name = names[n.type];
+		if (!ClassDB::class_exists(class_name) || ClassDB::get_api_type(class_name) != ClassDB::API_CORE || !ClassDB::can_instantiate(class_name)) {
+			continue;
+		}
+
+		InstantiationPlan::NodePlan &node_plan = instantiation_plan.nodes[i];
+		node_plan.planned = true;
+		node_plan.setters.resize(n.properties.size());
+		for (int j = 0; j < n.properties.size(); j++) {
+			const NodeData::Property &prop = n.properties[j];
+			if ((prop.name & FLAG_PATH_PROPERTY_IS_NODE) || prop.name < 0 || prop.name >= names.size()) {
+				continue;
+			}
+			node_plan.setters[j].method = ClassDB::get_property_setter_method(class_name, names[prop.name], &node_plan.setters[j].index);
+		}
+	}
+
+	instantiation_plan.connection_binds.resize(connections.size());
+	for (int i = 0; i < connections.size(); i++) {
+		const ConnectionData &c = connections[i];
+		Vector<Variant> &binds = instantiation_plan.connection_binds[i];
+		binds.resize(c.binds.size());
+		for (int j = 0; j < c.binds.size(); j++) {
+			ERR_CONTINUE(c.binds[j] < 0 || c.binds[j] >= variants.size());
+			binds.write[j] = variants[c.binds[j]];
+		}
+	}
+
+	instantiation_plan_built.set();
+	return instantiation_plan;
+}
+
+void SceneState::_clear_instantiation_plan() {
+	if (!instantiation_plan_built.is_set()) {
+		return;
+	}
+
+	MutexLock lock(instantiation_plan_mutex);
+	instantiation_plan.nodes.clear();
+	instantiation_plan.connection_binds.clear();
+	instantiation_plan_built.clear();
+}
+
 Variant SceneState::make_local_resource(Variant &p_value, const SceneState::NodeData &p_node_data, HashMap<Ref<Resource>, Ref<Resource>> &p_resources_local_to_sub_scene, Node *p_node, const StringName p_sname, HashMap<Ref<Resource>, Ref<Resource>> &p_resources_local_to_scene, int p_i, Node **p_ret_nodes, SceneState::GenEditState p_edit_state) const {
 	Ref<Resource> res = p_value;
 	if (res.is_null() || !res->is_local_to_scene()) {
@@ -1223,6 +1314,7 @@ void SceneState::clear() {
 	node_paths.clear();
 	editable_instances.clear();
 	base_scene_idx = -1;
+	_clear_instantiation_plan();
 }
 
 Error SceneState::copy_from(const Ref<SceneState> &p_scene_state) {
@@ -1270,6 +1362,8 @@ Ref<SceneState> SceneState::get_base_scene_state() const {
 void SceneState::update_instance_resource(String p_path, Ref<PackedScene> p_packed_scene) {
 	ERR_FAIL_COND(p_packed_scene.is_null());
 
+	_clear_instantiation_plan();
+
 	for (const NodeData &nd : nodes) {
 		if (nd.instance >= 0) {
 			if (!(nd.instance & FLAG_INSTANCE_IS_PLACEHOLDER)) {
@@ -1432,6 +1526,8 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 
 	ERR_FAIL_COND_MSG(version > PACKED_SCENE_VERSION, "Save format version too new.");
 
+	_clear_instantiation_plan();
+
 	const int node_count = p_dictionary["node_count"];
 	const Vector<int> snodes = p_dictionary["nodes"];
 	ERR_FAIL_COND(snodes.size() < node_count);
@@ -1883,11 +1979,13 @@ Vector<NodePath> SceneState::get_editable_instances() const {
 //add
 
 int SceneState::add_name(const StringName &p_name) {
+	_clear_instantiation_plan();
 	names.push_back(p_name);
 	return names.size() - 1;
 }
 
 int SceneState::add_value(const Variant &p_value) {
+	_clear_instantiation_plan();
 	variants.push_back(p_value);
 	return variants.size() - 1;
 }
@@ -1906,6 +2004,7 @@ int SceneState::add_node(int p_parent, int p_owner, int p_type, int p_name, int
 	nd.instance = p_instance;
 	nd.index = p_index;
 
+	_clear_instantiation_plan();
 	nodes.push_back(nd);
 
 	return nodes.size() - 1;
@@ -1922,6 +2021,7 @@ void SceneState::add_node_property(int p_node, int p_name, int p_value, bool p_d
 		prop.name |= FLAG_PATH_PROPERTY_IS_NODE;
 	}
 	prop.value = p_value;
+	_clear_instantiation_plan();
 	nodes.write[p_node].properties.push_back(prop);
 }
 
@@ -1933,6 +2033,7 @@ void SceneState::add_node_group(int p_node, int p_group) {
 
 void SceneState::set_base_scene(int p_idx) {
 	ERR_FAIL_INDEX(p_idx, variants.size());
+	_clear_instantiation_plan();
 	base_scene_idx = p_idx;
 }
 
@@ -1951,6 +2052,7 @@ void SceneState::add_connection(int p_from, int p_to, int p_signal, int p_method
 	c.flags = p_flags;
 	c.unbinds = p_unbinds;
 	c.binds = p_binds;
+	_clear_instantiation_plan();
 	connections.push_back(c);
 }
 
@@ -2044,6 +2146,7 @@ SceneState::SceneState() {
 ////////////////
 
 void PackedScene::_set_bundled_scene(const Dictionary &p_scene) {
+	clear_pool();
 	state->set_bundled_scene(p_scene);
 }
 
@@ -2052,10 +2155,12 @@ Dictionary PackedScene::_get_bundled_scene() const {
 }
 
 Error PackedScene::pack(Node *p_scene) {
+	clear_pool();
 	return state->pack(p_scene);
 }
 
 void PackedScene::clear() {
+	clear_pool();
 	state->clear();
 }
 
@@ -2109,6 +2214,7 @@ Node *PackedScene::instantiate(GenEditState p_edit_state) const {
 }
 
 void PackedScene::replace_state(Ref<SceneState> p_by) {
+	clear_pool();
 	state = p_by;
 	state->set_path(get_path());
 #ifdef TOOLS_ENABLED
@@ -2117,6 +2223,7 @@ void PackedScene::replace_state(Ref<SceneState> p_by) {
 }
 
 void PackedScene::recreate_state() {
+	clear_pool();
 	state = Ref<SceneState>(memnew(SceneState));
 	state->set_path(get_path());
 #ifdef TOOLS_ENABLED
@@ -2124,6 +2231,203 @@ void PackedScene::recreate_state() {
 #endif
 }
 
+// Values that belong to a single instance, which a pooled one must keep as they are.
+static bool _is_instance_bound_value(const Variant &p_value) {
+	switch (p_value.get_type()) {
+		case Variant::OBJECT: {
+			Object *obj = p_value.get_validated_object();
+			if (!obj) {
+				return false;
+			}
+			Resource *res = Object::cast_to<Resource>(obj);
+			return !res || res->is_local_to_scene();
+		}
+		case Variant::ARRAY: {
+			const Array array = p_value;
+			for (int i = 0; i < array.size(); i++) {
+				if (_is_instance_bound_value(array[i])) {
+					return true;
+				}
+			}
+			return false;
+		}
+		case Variant::DICTIONARY: {
+			const Dictionary dictionary = p_value;
+			return _is_instance_bound_value(dictionary.keys()) || _is_instance_bound_value(dictionary.values());
+		}
+		default: {
+			return false;
+		}
+	}
+}
+
+void PackedScene::_build_pool_reset() {
+	pool_reset_built = true;
+	pool_reset_nodes.clear();
+	pool_reset_properties.clear();
+
+	Node *pristine = instantiate();
+	ERR_FAIL_NULL(pristine);
+	pool_reset_root_name = pristine->get_name();
+
+	LocalVector<Node *> to_visit;
+	to_visit.push_back(pristine);
+	for (uint32_t i = 0; i < to_visit.size(); i++) {
+		Node *node = to_visit[i];
+		pool_reset_nodes.push_back(pristine->get_path_to(node));
+
+		List<PropertyInfo> properties;
+		node->get_property_list(&properties);
+		for (const PropertyInfo &E : properties) {
+			if (!(E.usage & PROPERTY_USAGE_STORAGE) || E.name == CoreStringName(script)) {
+				continue;
+			}
+			PoolResetProperty prop;
+			prop.value = node->get(E.name);
+			if (_is_instance_bound_value(prop.value)) {
+				continue;
+			}
+			prop.node = i;
+			prop.name = E.name;
+			pool_reset_properties.push_back(prop);
+		}
+
+		for (int j = 0; j < node->get_child_count(false); j++) {
+			to_visit.push_back(node->get_child(j, false));
+		}
+	}
+
+	memdelete(pristine);
+}
+
+bool PackedScene::_reset_pooled_instance(Node *p_instance) const {
+	LocalVector<Node *> nodes;
+	nodes.resize(pool_reset_nodes.size());
+	for (uint32_t i = 0; i < nodes.size(); i++) {
+		nodes[i] = i == 0 ? p_instance : p_instance->get_node_or_null(pool_reset_nodes[i]);
+		if (!nodes[i]) {
+			return false; // The structure of the instance changed, it can't be reused.
+		}
+	}
+
+	// Children added after instantiation are not part of a fresh instance.
+	HashSet<Node *> pristine_nodes;
+	for (Node *node : nodes) {
+		pristine_nodes.insert(node);
+	}
+	LocalVector<Node *> added_children;
+	for (Node *node : nodes) {
+		for (int i = 0; i < node->get_child_count(false); i++) {
+			Node *child = node->get_child(i, false);
+			if (!pristine_nodes.has(child)) {
+				added_children.push_back(child);
+			}
+		}
+	}
+	for (Node *child : added_children) {
+		child->get_parent()->remove_child(child);
+		memdelete(child);
+	}
+
+	if (p_instance->get_name() != pool_reset_root_name) {
+		p_instance->set_name(pool_reset_root_name);
+	}
+
+	for (const PoolResetProperty &E : pool_reset_properties) {
+		Node *node = nodes[E.node];
+		bool valid = false;
+		Variant current = node->get(E.name, &valid);
+		// Only what changed is set again, sparing everything else the setters' side effects.
+		if (valid && current != E.value) {
+			if (E.value.get_type() == Variant::ARRAY || E.value.get_type() == Variant::DICTIONARY) {
+				node->set(E.name, E.value.duplicate());
+			} else {
+				node->set(E.name, E.value);
+			}
+		}
+	}
+
+	// Let scripts set themselves up again the next time it enters the tree.
+	for (Node *node : nodes) {
+		node->request_ready();
+	}
+	return true;
+}
+
+Node *PackedScene::instantiate_pooled() {
+	{
+		MutexLock lock(pool_mutex);
+		if (pool.size()) {
+			Node *instance = pool[pool.size() - 1];
+			pool.resize(pool.size() - 1);
+			return instance;
+		}
+	}
+
+	return instantiate();
+}
+
+void PackedScene::release_instance(Node *p_instance) {
+	ERR_FAIL_NULL(p_instance);
+	ERR_FAIL_COND_MSG(!is_built_in() && p_instance->get_scene_file_path() != get_path(), "The node to release was not instantiated from this scene.");
+	ERR_FAIL_COND_MSG(p_instance->is_queued_for_deletion(), "The node to release is already queued for deletion.");
+
+	MutexLock lock(pool_mutex);
+	ERR_FAIL_COND_MSG(pool.has(p_instance), "The node to release is already in the pool.");
+
+	if ((int)pool.size() >= pool_capacity) {
+		p_instance->queue_free();
+		return;
+	}
+
+	if (p_instance->get_parent()) {
+		p_instance->get_parent()->remove_child(p_instance);
+	}
+
+	if (!pool_reset_built) {
+		_build_pool_reset();
+	}
+	if (!_reset_pooled_instance(p_instance)) {
+		p_instance->queue_free();
+		return;
+	}
+
+	pool.push_back(p_instance);
+}
+
+void PackedScene::clear_pool() {
+	MutexLock lock(pool_mutex);
+	for (Node *E : pool) {
+		memdelete(E);
+	}
+	pool.clear();
+
+	pool_reset_built = false;
+	pool_reset_root_name = StringName();
+	pool_reset_nodes.clear();
+	pool_reset_properties.clear();
+}
+
+void PackedScene::set_pool_capacity(int p_capacity) {
+	ERR_FAIL_COND(p_capacity < 0);
+
+	MutexLock lock(pool_mutex);
+	pool_capacity = p_capacity;
+	while ((int)pool.size() > pool_capacity) {
+		memdelete(pool[pool.size() - 1]);
+		pool.resize(pool.size() - 1);
+	}
+}
+
+int PackedScene::get_pool_capacity() const {
+	return pool_capacity;
+}
+
+int PackedScene::get_pooled_instance_count() const {
+	MutexLock lock(pool_mutex);
+	return pool.size();
+}
+
 #ifdef TOOLS_ENABLED
 HashSet<StringName> PackedScene::get_scene_groups(const String &p_path) {
 	{
@@ -2198,6 +2502,12 @@ void PackedScene::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("_set_bundled_scene", "scene"), &PackedScene::_set_bundled_scene);
 	ClassDB::bind_method(D_METHOD("_get_bundled_scene"), &PackedScene::_get_bundled_scene);
 	ClassDB::bind_method(D_METHOD("get_state"), &PackedScene::get_state);
+	ClassDB::bind_method(D_METHOD("instantiate_pooled"), &PackedScene::instantiate_pooled);
+	ClassDB::bind_method(D_METHOD("release_instance", "instance"), &PackedScene::release_instance);
+	ClassDB::bind_method(D_METHOD("clear_pool"), &PackedScene::clear_pool);
+	ClassDB::bind_method(D_METHOD("set_pool_capacity", "capacity"), &PackedScene::set_pool_capacity);
+	ClassDB::bind_method(D_METHOD("get_pool_capacity"), &PackedScene::get_pool_capacity);
+	ClassDB::bind_method(D_METHOD("get_pooled_instance_count"), &PackedScene::get_pooled_instance_count);
 
 	ADD_PROPERTY(PropertyInfo(Variant::DICTIONARY, "_bundled"), "_set_bundled_scene", "_get_bundled_scene");
 
@@ -2210,3 +2520,7 @@ void PackedScene::_bind_methods() {
 PackedScene::PackedScene() {
 	state = Ref<SceneState>(memnew(SceneState));
 }
+
+PackedScene::~PackedScene() {
+	clear_pool();
+}
@@ -89,6 +89,29 @@ class SceneState : public RefCounted {
 
 	Vector<ConnectionData> connections;
 
+	// What can be resolved ahead of time for instantiating at runtime, so doing it repeatedly skips the ClassDB lookups.
+	struct InstantiationPlan {
+		struct Setter {
+			MethodBind *method = nullptr; // Null if Object::set() has to figure it out.
+			int index = -1;
+		};
+
+		struct NodePlan {
+			bool planned = false; // False if not created directly from an engine class.
+			LocalVector<Setter> setters; // One per property, if planned.
+		};
+
+		LocalVector<NodePlan> nodes;
+		LocalVector<Vector<Variant>> connection_binds;
+	};
+
+	mutable InstantiationPlan instantiation_plan;
+	mutable SafeFlag instantiation_plan_built;
+	mutable BinaryMutex instantiation_plan_mutex;
+
+	const InstantiationPlan &_get_instantiation_plan() const;
+	void _clear_instantiation_plan();
+
 	Error _parse_node(Node *p_owner, Node *p_node, int p_parent_idx, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 	Error _parse_connections(Node *p_owner, Node *p_node, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 
@@ -233,6 +256,25 @@ class PackedScene : public Resource {
 
 	Ref<SceneState> state;
 
+	// Instances handed back through release_instance(), to be reused by instantiate_pooled().
+	struct PoolResetProperty {
+		int node = 0;
+		StringName name;
+		Variant value;
+	};
+
+	LocalVector<Node *> pool;
+	int pool_capacity = 64;
+	// What a fresh instance looks like, so released ones can be brought back to it.
+	bool pool_reset_built = false;
+	StringName pool_reset_root_name;
+	LocalVector<NodePath> pool_reset_nodes; // Relative to the root, which comes first.
+	LocalVector<PoolResetProperty> pool_reset_properties;
+	mutable Mutex pool_mutex;
+
+	void _build_pool_reset();
+	bool _reset_pooled_instance(Node *p_instance) const;
+
 	void _set_bundled_scene(const Dictionary &p_scene);
 	Dictionary _get_bundled_scene() const;
 
@@ -259,6 +301,13 @@ public:
 	void recreate_state();
 	void replace_state(Ref<SceneState> p_by);
 
+	Node *instantiate_pooled();
+	void release_instance(Node *p_instance);
+	void clear_pool();
+	void set_pool_capacity(int p_capacity);
+	int get_pool_capacity() const;
+	int get_pooled_instance_count() const;
+
 	virtual void reload_from_file() override;
 
 	virtual void set_path(const String &p_path, bool p_take_over = false) override;
@@ -275,6 +324,7 @@ public:
 	Ref<SceneState> get_state() const;
 
 	PackedScene();
+	~PackedScene();
 };
 
 VARIANT_ENUM_CAST(PackedScene::GenEditState)
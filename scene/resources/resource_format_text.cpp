@@ -33,7 +33,10 @@
 #include "core/config/project_settings.h"
 #include "core/io/dir_access.h"
 #include "core/io/missing_resource.h"
+#include "core/io/resource_format_binary.h"
 #include "core/object/script_language.h"
+#include "core/os/os.h"
+#include "core/version.h"
 
 // Version 2: Changed names for Basis, AABB, Vectors, etc.
 // Version 3: New string ID for ext/subresources, breaks forward compat.
@@ -500,6 +503,11 @@ Error ResourceLoaderText::load() {
 			break;
 		}
 
+		if (ResourceLoader::is_load_cancelled()) {
+			error = ERR_SKIP;
+			return error;
+		}
+
 		if (!next_tag.fields.has("type")) {
 			error = ERR_FILE_CORRUPT;
 			error_text = "Missing 'type' in external resource tag";
@@ -1355,6 +1363,42 @@ ResourceUID::ID ResourceLoaderText::get_uid(Ref<FileAccess> p_f) {
 
 /////////////////////
 
+#ifdef DEBUG_ENABLED
+bool ResourceFormatLoaderText::binary_cache_enabled = false;
+
+String ResourceFormatLoaderText::get_binary_cache_path(const String &p_local_path) {
+	// Exported projects can't write to the project data folder, which lives inside the pack.
+	String cache_dir = OS::get_singleton()->has_feature("template") ? String("user://text_resource_cache") : ProjectSettings::get_singleton()->get_project_data_path().path_join("text_resource_cache");
+	return cache_dir.path_join(p_local_path.md5_text() + ".res");
+}
+
+String ResourceFormatLoaderText::_get_binary_cache_stamp(const String &p_path) {
+	// Hashing the contents catches every edit, unlike the length and modification time,
+	// which miss rewrites of the same size within the timestamp resolution.
+	return String(VERSION_FULL_BUILD) + "\n" + p_path + "\n" + FileAccess::get_md5(p_path);
+}
+
+void ResourceFormatLoaderText::_save_binary_cache(const Ref<Resource> &p_resource, const String &p_cache_path, const String &p_stamp) {
+	String stamp_path = p_cache_path + ".stamp";
+	if (FileAccess::exists(stamp_path)) {
+		// Invalidate first, so an interrupted save never pairs a fresh stamp with stale data.
+		DirAccess::remove_absolute(stamp_path);
+	}
+
+	if (DirAccess::make_dir_recursive_absolute(p_cache_path.get_base_dir()) != OK) {
+		return;
+	}
+	if (ResourceFormatSaverBinary::singleton->save(p_resource, p_cache_path) != OK) {
+		return;
+	}
+
+	Ref<FileAccess> f = FileAccess::open(stamp_path, FileAccess::WRITE);
+	if (f.is_valid()) {
+		f->store_string(p_stamp);
+	}
+}
+#endif
+
 Ref<Resource> ResourceFormatLoaderText::load(const String &p_path, const String &p_original_path, Error *r_error, bool p_use_sub_threads, float *r_progress, CacheMode p_cache_mode) {
 	if (r_error) {
 		*r_error = ERR_CANT_OPEN;
@@ -1366,8 +1410,32 @@ Ref<Resource> ResourceFormatLoaderText::load(const String &p_path, const String
 
 	ERR_FAIL_COND_V_MSG(err != OK, Ref<Resource>(), "Cannot open file '" + p_path + "'.");
 
-	ResourceLoaderText loader;
 	String path = !p_original_path.is_empty() ? p_original_path : p_path;
+
+#ifdef DEBUG_ENABLED
+	// The text file stays the source of truth; the binary copy is only reused while its stamp matches.
+	String cache_path;
+	String cache_stamp;
+	if (binary_cache_enabled) {
+		cache_path = get_binary_cache_path(ProjectSettings::get_singleton()->localize_path(path));
+		cache_stamp = _get_binary_cache_stamp(p_path);
+
+		Error stamp_err;
+		if (FileAccess::get_file_as_string(cache_path + ".stamp", &stamp_err) == cache_stamp && stamp_err == OK) {
+			Ref<ResourceFormatLoaderBinary> binary_loader;
+			binary_loader.instantiate();
+			Ref<Resource> cached = binary_loader->load(cache_path, path, r_error, p_use_sub_threads, r_progress, p_cache_mode);
+			if (cached.is_valid()) {
+				return cached;
+			}
+			if (r_error) {
+				*r_error = ERR_CANT_OPEN;
+			}
+		}
+	}
+#endif
+
+	ResourceLoaderText loader;
 	switch (p_cache_mode) {
 		case CACHE_MODE_IGNORE:
 		case CACHE_MODE_REUSE:
@@ -1394,6 +1462,11 @@ Ref<Resource> ResourceFormatLoaderText::load(const String &p_path, const String
 		*r_error = err;
 	}
 	if (err == OK) {
+#ifdef DEBUG_ENABLED
+		if (binary_cache_enabled) {
+			_save_binary_cache(loader.get_resource(), cache_path, cache_stamp);
+		}
+#endif
 		return loader.get_resource();
 	} else {
 		return Ref<Resource>();
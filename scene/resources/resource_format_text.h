@@ -132,8 +132,19 @@ public:
 };
 
 class ResourceFormatLoaderText : public ResourceFormatLoader {
+#ifdef DEBUG_ENABLED
+	static bool binary_cache_enabled;
+
+	static String _get_binary_cache_stamp(const String &p_path);
+	static void _save_binary_cache(const Ref<Resource> &p_resource, const String &p_cache_path, const String &p_stamp);
+#endif
+
 public:
 	static ResourceFormatLoaderText *singleton;
+#ifdef DEBUG_ENABLED
+	static void set_binary_cache_enabled(bool p_enabled) { binary_cache_enabled = p_enabled; }
+	static String get_binary_cache_path(const String &p_local_path);
+#endif
 	virtual Ref<Resource> load(const String &p_path, const String &p_original_path = "", Error *r_error = nullptr, bool p_use_sub_threads = false, float *r_progress = nullptr, CacheMode p_cache_mode = CACHE_MODE_REUSE) override;
 	virtual void get_recognized_extensions_for_type(const String &p_type, List<String> *p_extensions) const override;
 	virtual void get_recognized_extensions(List<String> *p_extensions) const override;
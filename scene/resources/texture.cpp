@@ -94,6 +94,15 @@ Ref<Resource> Texture2D::create_placeholder() const {
 	return placeholder;
 }
 
+uint64_t Texture2D::get_memory_usage_estimate() const {
+	RID rid = get_rid();
+	if (!rid.is_valid()) {
+		return Texture::get_memory_usage_estimate();
+	}
+	// Mipmaps are not accounted for, since the rendering server doesn't expose whether a texture has them.
+	return Image::get_image_data_size(get_width(), get_height(), RS::get_singleton()->texture_get_format(rid), false);
+}
+
 void Texture2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_width"), &Texture2D::get_width);
 	ClassDB::bind_method(D_METHOD("get_height"), &Texture2D::get_height);
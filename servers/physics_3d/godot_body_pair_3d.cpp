@@ -314,6 +314,10 @@ bool GodotBodyPair3D::setup(real_t p_step) {
 }
 
 bool GodotBodyPair3D::pre_solve(real_t p_step) {
+	block_solver = space->get_solver_type() == PhysicsServer3D::SPACE_SOLVER_TYPE_BLOCK;
+	block_contact_count = 0;
+	block_contact_mask = 0;
+
 	if (!collided) {
 		if (check_ccd) {
 			const Vector3 &offset_A = A->get_transform().get_origin();
@@ -405,6 +409,14 @@ bool GodotBodyPair3D::pre_solve(real_t p_step) {
 		c.bias = -bias * inv_dt * MIN(0.0f, -depth + max_penetration);
 		c.depth = depth;
 
+		if (block_solver) {
+			// Bias impulses only act on the biased velocities, which are reset every step, so they can't be warm started.
+			c.acc_bias_impulse = 0.0;
+			c.acc_bias_impulse_center_of_mass = 0.0;
+			// A recycled contact may have a slightly different normal, keep its friction impulse tangent.
+			c.acc_tangent_impulse -= c.normal * c.normal.dot(c.acc_tangent_impulse);
+		}
+
 		Vector3 j_vec = c.normal * c.acc_normal_impulse + c.acc_tangent_impulse;
 
 		c.acc_impulse -= j_vec;
@@ -448,148 +460,306 @@ bool GodotBodyPair3D::pre_solve(real_t p_step) {
 		}
 	}
 
+	if (block_solver && do_process) {
+		_setup_block_contacts(inv_inertia_tensor_A, inv_inertia_tensor_B, inv_mass_A + inv_mass_B);
+	}
+
 	return do_process;
 }
 
-void GodotBodyPair3D::solve(real_t p_step) {
-	if (!collided) {
-		return;
+void GodotBodyPair3D::_setup_block_contacts(const Basis &p_inv_inertia_tensor_A, const Basis &p_inv_inertia_tensor_B, real_t p_inv_mass_sum) {
+	// Above this condition number of K, the contacts are solved one by one instead.
+	const real_t max_condition_number = 1000.0;
+
+	int first = -1;
+	for (int i = 0; i < contact_count; i++) {
+		if (!contacts[i].active) {
+			continue;
+		}
+		if (first == -1) {
+			first = i;
+			continue;
+		}
+
+		const Contact &c1 = contacts[first];
+		const Contact &c2 = contacts[i];
+
+		Vector3 rnA1 = c1.rA.cross(c1.normal);
+		Vector3 rnB1 = c1.rB.cross(c1.normal);
+		Vector3 rnA2 = c2.rA.cross(c2.normal);
+		Vector3 rnB2 = c2.rB.cross(c2.normal);
+
+		real_t k11 = p_inv_mass_sum + rnA1.dot(p_inv_inertia_tensor_A.xform(rnA1)) + rnB1.dot(p_inv_inertia_tensor_B.xform(rnB1));
+		real_t k22 = p_inv_mass_sum + rnA2.dot(p_inv_inertia_tensor_A.xform(rnA2)) + rnB2.dot(p_inv_inertia_tensor_B.xform(rnB2));
+		real_t k12 = p_inv_mass_sum * c1.normal.dot(c2.normal) + rnA1.dot(p_inv_inertia_tensor_A.xform(rnA2)) + rnB1.dot(p_inv_inertia_tensor_B.xform(rnB2));
+		real_t det = k11 * k22 - k12 * k12;
+
+		if (k11 * k11 < max_condition_number * det) {
+			BlockContact &block = block_contacts[block_contact_count++];
+			block.index_1 = first;
+			block.index_2 = i;
+			block.k11 = k11;
+			block.k12 = k12;
+			block.k22 = k22;
+
+			real_t inv_det = 1.0 / det;
+			block.inv_k11 = k22 * inv_det;
+			block.inv_k12 = -k12 * inv_det;
+			block.inv_k22 = k11 * inv_det;
+
+			block_contact_mask |= (1 << first) | (1 << i);
+		}
+
+		first = -1;
 	}
+}
 
-	const real_t max_bias_av = MAX_BIAS_ROTATION / p_step;
+void GodotBodyPair3D::_apply_normal_impulse(Contact &p_contact, real_t p_impulse) {
+	Vector3 j = p_contact.normal * p_impulse;
 
-	Basis zero_basis;
-	zero_basis.set_zero();
+	if (collide_A) {
+		A->apply_impulse(-j, p_contact.rA + A->get_center_of_mass());
+	}
+	if (collide_B) {
+		B->apply_impulse(j, p_contact.rB + B->get_center_of_mass());
+	}
+	p_contact.acc_impulse -= j;
+}
 
-	const Basis &inv_inertia_tensor_A = collide_A ? A->get_inv_inertia_tensor() : zero_basis;
-	const Basis &inv_inertia_tensor_B = collide_B ? B->get_inv_inertia_tensor() : zero_basis;
+bool GodotBodyPair3D::_solve_bias_impulse(Contact &p_contact, real_t p_max_bias_av, real_t p_inv_mass_sum) {
+	Contact &c = p_contact;
 
-	real_t inv_mass_A = collide_A ? A->get_inv_mass() : 0.0;
-	real_t inv_mass_B = collide_B ? B->get_inv_mass() : 0.0;
+	Vector3 crbA = A->get_biased_angular_velocity().cross(c.rA);
+	Vector3 crbB = B->get_biased_angular_velocity().cross(c.rB);
+	Vector3 dbv = B->get_biased_linear_velocity() + crbB - A->get_biased_linear_velocity() - crbA;
 
-	for (int i = 0; i < contact_count; i++) {
-		Contact &c = contacts[i];
-		if (!c.active) {
-			continue;
+	real_t vbn = dbv.dot(c.normal);
+
+	if (Math::abs(-vbn + c.bias) <= MIN_VELOCITY) {
+		return false;
+	}
+
+	real_t jbn = (-vbn + c.bias) * c.mass_normal;
+	real_t jbnOld = c.acc_bias_impulse;
+	c.acc_bias_impulse = MAX(jbnOld + jbn, 0.0f);
+
+	Vector3 jb = c.normal * (c.acc_bias_impulse - jbnOld);
+
+	if (collide_A) {
+		A->apply_bias_impulse(-jb, c.rA + A->get_center_of_mass(), p_max_bias_av);
+	}
+	if (collide_B) {
+		B->apply_bias_impulse(jb, c.rB + B->get_center_of_mass(), p_max_bias_av);
+	}
+
+	crbA = A->get_biased_angular_velocity().cross(c.rA);
+	crbB = B->get_biased_angular_velocity().cross(c.rB);
+	dbv = B->get_biased_linear_velocity() + crbB - A->get_biased_linear_velocity() - crbA;
+
+	vbn = dbv.dot(c.normal);
+
+	if (Math::abs(-vbn + c.bias) > MIN_VELOCITY) {
+		real_t jbn_com = (-vbn + c.bias) / p_inv_mass_sum;
+		real_t jbnOld_com = c.acc_bias_impulse_center_of_mass;
+		c.acc_bias_impulse_center_of_mass = MAX(jbnOld_com + jbn_com, 0.0f);
+
+		Vector3 jb_com = c.normal * (c.acc_bias_impulse_center_of_mass - jbnOld_com);
+
+		if (collide_A) {
+			A->apply_bias_impulse(-jb_com, A->get_center_of_mass(), 0.0f);
 		}
+		if (collide_B) {
+			B->apply_bias_impulse(jb_com, B->get_center_of_mass(), 0.0f);
+		}
+	}
 
-		c.active = false; //try to deactivate, will activate itself if still needed
+	return true;
+}
 
-		//bias impulse
+bool GodotBodyPair3D::_solve_normal_impulse(Contact &p_contact) {
+	Contact &c = p_contact;
 
-		Vector3 crbA = A->get_biased_angular_velocity().cross(c.rA);
-		Vector3 crbB = B->get_biased_angular_velocity().cross(c.rB);
-		Vector3 dbv = B->get_biased_linear_velocity() + crbB - A->get_biased_linear_velocity() - crbA;
+	Vector3 crA = A->get_angular_velocity().cross(c.rA);
+	Vector3 crB = B->get_angular_velocity().cross(c.rB);
+	Vector3 dv = B->get_linear_velocity() + crB - A->get_linear_velocity() - crA;
 
-		real_t vbn = dbv.dot(c.normal);
+	real_t vn = dv.dot(c.normal);
 
-		if (Math::abs(-vbn + c.bias) > MIN_VELOCITY) {
-			real_t jbn = (-vbn + c.bias) * c.mass_normal;
-			real_t jbnOld = c.acc_bias_impulse;
-			c.acc_bias_impulse = MAX(jbnOld + jbn, 0.0f);
+	if (Math::abs(vn) <= MIN_VELOCITY) {
+		return false;
+	}
 
-			Vector3 jb = c.normal * (c.acc_bias_impulse - jbnOld);
+	real_t jn = -(c.bounce + vn) * c.mass_normal;
+	real_t jnOld = c.acc_normal_impulse;
+	c.acc_normal_impulse = MAX(jnOld + jn, 0.0f);
 
-			if (collide_A) {
-				A->apply_bias_impulse(-jb, c.rA + A->get_center_of_mass(), max_bias_av);
-			}
-			if (collide_B) {
-				B->apply_bias_impulse(jb, c.rB + B->get_center_of_mass(), max_bias_av);
-			}
+	_apply_normal_impulse(c, c.acc_normal_impulse - jnOld);
 
-			crbA = A->get_biased_angular_velocity().cross(c.rA);
-			crbB = B->get_biased_angular_velocity().cross(c.rB);
-			dbv = B->get_biased_linear_velocity() + crbB - A->get_biased_linear_velocity() - crbA;
+	return true;
+}
 
-			vbn = dbv.dot(c.normal);
+// Solves the normal impulses of two contacts at once, as a 2D linear complementarity problem:
+// find the accumulated impulses x >= 0 with vn = K * x + b >= 0 and x_i * vn_i == 0.
+// The four possible cases are tried in turn, as in the block solver of Box2D.
+void GodotBodyPair3D::_solve_block_normal_impulse(const BlockContact &p_block) {
+	Contact &c1 = contacts[p_block.index_1];
+	Contact &c2 = contacts[p_block.index_2];
 
-			if (Math::abs(-vbn + c.bias) > MIN_VELOCITY) {
-				real_t jbn_com = (-vbn + c.bias) / (inv_mass_A + inv_mass_B);
-				real_t jbnOld_com = c.acc_bias_impulse_center_of_mass;
-				c.acc_bias_impulse_center_of_mass = MAX(jbnOld_com + jbn_com, 0.0f);
+	Vector3 dv1 = B->get_linear_velocity() + B->get_angular_velocity().cross(c1.rB) - A->get_linear_velocity() - A->get_angular_velocity().cross(c1.rA);
+	Vector3 dv2 = B->get_linear_velocity() + B->get_angular_velocity().cross(c2.rB) - A->get_linear_velocity() - A->get_angular_velocity().cross(c2.rA);
 
-				Vector3 jb_com = c.normal * (c.acc_bias_impulse_center_of_mass - jbnOld_com);
+	real_t a1 = c1.acc_normal_impulse;
+	real_t a2 = c2.acc_normal_impulse;
 
-				if (collide_A) {
-					A->apply_bias_impulse(-jb_com, A->get_center_of_mass(), 0.0f);
-				}
-				if (collide_B) {
-					B->apply_bias_impulse(jb_com, B->get_center_of_mass(), 0.0f);
+	// Velocity error without the accumulated impulses: b = vn + bounce - K * a.
+	real_t b1 = dv1.dot(c1.normal) + c1.bounce - (p_block.k11 * a1 + p_block.k12 * a2);
+	real_t b2 = dv2.dot(c2.normal) + c2.bounce - (p_block.k12 * a1 + p_block.k22 * a2);
+
+	// Both contacts push: vn = 0, x = -inv(K) * b.
+	real_t x1 = -(p_block.inv_k11 * b1 + p_block.inv_k12 * b2);
+	real_t x2 = -(p_block.inv_k12 * b1 + p_block.inv_k22 * b2);
+
+	if (x1 < 0.0 || x2 < 0.0) {
+		// Only the first contact pushes: x2 = 0, vn1 = 0.
+		x1 = -b1 / p_block.k11;
+		x2 = 0.0;
+
+		if (x1 < 0.0 || p_block.k12 * x1 + b2 < 0.0) {
+			// Only the second contact pushes: x1 = 0, vn2 = 0.
+			x1 = 0.0;
+			x2 = -b2 / p_block.k22;
+
+			if (x2 < 0.0 || p_block.k12 * x2 + b1 < 0.0) {
+				// Neither contact pushes: x = 0.
+				x2 = 0.0;
+
+				if (b1 < 0.0 || b2 < 0.0) {
+					// No solution, which only happens for a degenerate K. Keep the previous impulses.
+					return;
 				}
 			}
-
-			c.active = true;
 		}
+	}
 
-		Vector3 crA = A->get_angular_velocity().cross(c.rA);
-		Vector3 crB = B->get_angular_velocity().cross(c.rB);
-		Vector3 dv = B->get_linear_velocity() + crB - A->get_linear_velocity() - crA;
+	c1.acc_normal_impulse = x1;
+	c2.acc_normal_impulse = x2;
 
-		//normal impulse
-		real_t vn = dv.dot(c.normal);
+	_apply_normal_impulse(c1, x1 - a1);
+	_apply_normal_impulse(c2, x2 - a2);
+}
 
-		if (Math::abs(vn) > MIN_VELOCITY) {
-			real_t jn = -(c.bounce + vn) * c.mass_normal;
-			real_t jnOld = c.acc_normal_impulse;
-			c.acc_normal_impulse = MAX(jnOld + jn, 0.0f);
+bool GodotBodyPair3D::_solve_friction_impulse(Contact &p_contact, real_t p_friction, const Basis &p_inv_inertia_tensor_A, const Basis &p_inv_inertia_tensor_B, real_t p_inv_mass_sum) {
+	Contact &c = p_contact;
 
-			Vector3 j = c.normal * (c.acc_normal_impulse - jnOld);
+	Vector3 lvA = A->get_linear_velocity() + A->get_angular_velocity().cross(c.rA);
+	Vector3 lvB = B->get_linear_velocity() + B->get_angular_velocity().cross(c.rB);
 
-			if (collide_A) {
-				A->apply_impulse(-j, c.rA + A->get_center_of_mass());
-			}
-			if (collide_B) {
-				B->apply_impulse(j, c.rB + B->get_center_of_mass());
-			}
-			c.acc_impulse -= j;
+	Vector3 dtv = lvB - lvA;
+	real_t tn = c.normal.dot(dtv);
 
-			c.active = true;
-		}
+	// tangential velocity
+	Vector3 tv = dtv - c.normal * tn;
+	real_t tvl = tv.length();
 
-		//friction impulse
+	if (tvl <= MIN_VELOCITY) {
+		return false;
+	}
 
-		real_t friction = combine_friction(A, B);
+	tv /= tvl;
 
-		Vector3 lvA = A->get_linear_velocity() + A->get_angular_velocity().cross(c.rA);
-		Vector3 lvB = B->get_linear_velocity() + B->get_angular_velocity().cross(c.rB);
+	Vector3 temp1 = p_inv_inertia_tensor_A.xform(c.rA.cross(tv));
+	Vector3 temp2 = p_inv_inertia_tensor_B.xform(c.rB.cross(tv));
 
-		Vector3 dtv = lvB - lvA;
-		real_t tn = c.normal.dot(dtv);
+	real_t t = -tvl / (p_inv_mass_sum + tv.dot(temp1.cross(c.rA) + temp2.cross(c.rB)));
 
-		// tangential velocity
-		Vector3 tv = dtv - c.normal * tn;
-		real_t tvl = tv.length();
+	Vector3 jt = t * tv;
 
-		if (tvl > MIN_VELOCITY) {
-			tv /= tvl;
+	Vector3 jtOld = c.acc_tangent_impulse;
+	c.acc_tangent_impulse += jt;
 
-			Vector3 temp1 = inv_inertia_tensor_A.xform(c.rA.cross(tv));
-			Vector3 temp2 = inv_inertia_tensor_B.xform(c.rB.cross(tv));
+	real_t fi_len = c.acc_tangent_impulse.length();
+	real_t jtMax = c.acc_normal_impulse * p_friction;
 
-			real_t t = -tvl / (inv_mass_A + inv_mass_B + tv.dot(temp1.cross(c.rA) + temp2.cross(c.rB)));
+	if (fi_len > CMP_EPSILON && fi_len > jtMax) {
+		c.acc_tangent_impulse *= jtMax / fi_len;
+	}
 
-			Vector3 jt = t * tv;
+	jt = c.acc_tangent_impulse - jtOld;
 
-			Vector3 jtOld = c.acc_tangent_impulse;
-			c.acc_tangent_impulse += jt;
+	if (collide_A) {
+		A->apply_impulse(-jt, c.rA + A->get_center_of_mass());
+	}
+	if (collide_B) {
+		B->apply_impulse(jt, c.rB + B->get_center_of_mass());
+	}
+	c.acc_impulse -= jt;
 
-			real_t fi_len = c.acc_tangent_impulse.length();
-			real_t jtMax = c.acc_normal_impulse * friction;
+	return true;
+}
 
-			if (fi_len > CMP_EPSILON && fi_len > jtMax) {
-				c.acc_tangent_impulse *= jtMax / fi_len;
+void GodotBodyPair3D::solve(real_t p_step) {
+	if (!collided) {
+		return;
+	}
+
+	const real_t max_bias_av = MAX_BIAS_ROTATION / p_step;
+
+	Basis zero_basis;
+	zero_basis.set_zero();
+
+	const Basis &inv_inertia_tensor_A = collide_A ? A->get_inv_inertia_tensor() : zero_basis;
+	const Basis &inv_inertia_tensor_B = collide_B ? B->get_inv_inertia_tensor() : zero_basis;
+
+	real_t inv_mass_A = collide_A ? A->get_inv_mass() : 0.0;
+	real_t inv_mass_B = collide_B ? B->get_inv_mass() : 0.0;
+	real_t inv_mass_sum = inv_mass_A + inv_mass_B;
+
+	real_t friction = combine_friction(A, B);
+
+	if (block_solver) {
+		// Contacts are never deactivated here, the coupled impulses must be revisited on every iteration.
+		for (int i = 0; i < contact_count; i++) {
+			if (contacts[i].active) {
+				_solve_bias_impulse(contacts[i], max_bias_av, inv_mass_sum);
 			}
+		}
 
-			jt = c.acc_tangent_impulse - jtOld;
+		for (int i = 0; i < block_contact_count; i++) {
+			_solve_block_normal_impulse(block_contacts[i]);
+		}
 
-			if (collide_A) {
-				A->apply_impulse(-jt, c.rA + A->get_center_of_mass());
+		for (int i = 0; i < contact_count; i++) {
+			if (contacts[i].active && !(block_contact_mask & (1 << i))) {
+				_solve_normal_impulse(contacts[i]);
 			}
-			if (collide_B) {
-				B->apply_impulse(jt, c.rB + B->get_center_of_mass());
+		}
+
+		for (int i = 0; i < contact_count; i++) {
+			if (contacts[i].active) {
+				_solve_friction_impulse(contacts[i], friction, inv_inertia_tensor_A, inv_inertia_tensor_B, inv_mass_sum);
 			}
-			c.acc_impulse -= jt;
+		}
+
+		return;
+	}
+
+	for (int i = 0; i < contact_count; i++) {
+		Contact &c = contacts[i];
+		if (!c.active) {
+			continue;
+		}
+
+		c.active = false; //try to deactivate, will activate itself if still needed
+
+		if (_solve_bias_impulse(c, max_bias_av, inv_mass_sum)) {
+			c.active = true;
+		}
+
+		if (_solve_normal_impulse(c)) {
+			c.active = true;
+		}
 
+		if (_solve_friction_impulse(c, friction, inv_inertia_tensor_A, inv_inertia_tensor_B, inv_mass_sum)) {
 			c.active = true;
 		}
 	}
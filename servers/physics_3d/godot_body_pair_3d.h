@@ -97,6 +97,19 @@ class GodotBodyPair3D : public GodotBodyContact3D {
 	Contact contacts[MAX_CONTACTS];
 	int contact_count = 0;
 
+	// Two contacts whose normal impulses are solved together by the block solver.
+	struct BlockContact {
+		int index_1 = 0;
+		int index_2 = 0;
+		real_t k11 = 0.0, k12 = 0.0, k22 = 0.0; // effective mass matrix (K)
+		real_t inv_k11 = 0.0, inv_k12 = 0.0, inv_k22 = 0.0; // inverse of K
+	};
+
+	bool block_solver = false;
+	BlockContact block_contacts[MAX_CONTACTS / 2];
+	int block_contact_count = 0;
+	uint32_t block_contact_mask = 0; // contacts solved by a block, one bit per contact index
+
 	static void _contact_added_callback(const Vector3 &p_point_A, int p_index_A, const Vector3 &p_point_B, int p_index_B, const Vector3 &normal, void *p_userdata);
 
 	void contact_added_callback(const Vector3 &p_point_A, int p_index_A, const Vector3 &p_point_B, int p_index_B, const Vector3 &normal);
@@ -104,6 +117,13 @@ class GodotBodyPair3D : public GodotBodyContact3D {
 	void validate_contacts();
 	bool _test_ccd(real_t p_step, GodotBody3D *p_A, int p_shape_A, const Transform3D &p_xform_A, GodotBody3D *p_B, int p_shape_B, const Transform3D &p_xform_B);
 
+	void _setup_block_contacts(const Basis &p_inv_inertia_tensor_A, const Basis &p_inv_inertia_tensor_B, real_t p_inv_mass_sum);
+	void _apply_normal_impulse(Contact &p_contact, real_t p_impulse);
+	bool _solve_bias_impulse(Contact &p_contact, real_t p_max_bias_av, real_t p_inv_mass_sum);
+	bool _solve_normal_impulse(Contact &p_contact);
+	void _solve_block_normal_impulse(const BlockContact &p_block);
+	bool _solve_friction_impulse(Contact &p_contact, real_t p_friction, const Basis &p_inv_inertia_tensor_A, const Basis &p_inv_inertia_tensor_B, real_t p_inv_mass_sum);
+
 public:
 	virtual bool setup(real_t p_step) override;
 	virtual bool pre_solve(real_t p_step) override;
@@ -612,6 +612,29 @@ static void _generate_contacts_from_supports(const Vector3 *p_points_A, int p_po
 	contacts_func(points_A, pointcount_A, points_B, pointcount_B, p_callback);
 }
 
+// Projections of primitive shapes are inlined, so separating axis tests between
+// primitives (boxes, spheres, capsules, cylinders) avoid a virtual call per axis.
+template <typename S>
+static _FORCE_INLINE_ void _project_range(const S *p_shape, const Vector3 &p_normal, const Transform3D &p_transform, real_t &r_min, real_t &r_max) {
+	p_shape->project_range(p_normal, p_transform, r_min, r_max);
+}
+
+static _FORCE_INLINE_ void _project_range(const GodotSphereShape3D *p_shape, const Vector3 &p_normal, const Transform3D &p_transform, real_t &r_min, real_t &r_max) {
+	p_shape->project_range_inline(p_normal, p_transform, r_min, r_max);
+}
+
+static _FORCE_INLINE_ void _project_range(const GodotBoxShape3D *p_shape, const Vector3 &p_normal, const Transform3D &p_transform, real_t &r_min, real_t &r_max) {
+	p_shape->project_range_inline(p_normal, p_transform, r_min, r_max);
+}
+
+static _FORCE_INLINE_ void _project_range(const GodotCapsuleShape3D *p_shape, const Vector3 &p_normal, const Transform3D &p_transform, real_t &r_min, real_t &r_max) {
+	p_shape->project_range_inline(p_normal, p_transform, r_min, r_max);
+}
+
+static _FORCE_INLINE_ void _project_range(const GodotCylinderShape3D *p_shape, const Vector3 &p_normal, const Transform3D &p_transform, real_t &r_min, real_t &r_max) {
+	p_shape->project_range_inline(p_normal, p_transform, r_min, r_max);
+}
+
 template <typename ShapeA, typename ShapeB, bool withMargin = false>
 class SeparatorAxisTest {
 	const ShapeA *shape_A = nullptr;
@@ -645,8 +668,8 @@ public:
 
 		real_t min_A = 0.0, max_A = 0.0, min_B = 0.0, max_B = 0.0;
 
-		shape_A->project_range(axis, *transform_A, min_A, max_A);
-		shape_B->project_range(axis, *transform_B, min_B, max_B);
+		_project_range(shape_A, axis, *transform_A, min_A, max_A);
+		_project_range(shape_B, axis, *transform_B, min_B, max_B);
 
 		if (withMargin) {
 			min_A -= margin_A;
@@ -254,17 +254,6 @@ real_t GodotSphereShape3D::get_radius() const {
 	return radius;
 }
 
-void GodotSphereShape3D::project_range(const Vector3 &p_normal, const Transform3D &p_transform, real_t &r_min, real_t &r_max) const {
-	real_t d = p_normal.dot(p_transform.origin);
-
-	// figure out scale at point
-	Vector3 local_normal = p_transform.basis.xform_inv(p_normal);
-	real_t scale = local_normal.length();
-
-	r_min = d - (radius)*scale;
-	r_max = d + (radius)*scale;
-}
-
 Vector3 GodotSphereShape3D::get_support(const Vector3 &p_normal) const {
 	return p_normal * radius;
 }
@@ -314,17 +303,6 @@ GodotSphereShape3D::GodotSphereShape3D() {}
 
 /********** BOX *************/
 
-void GodotBoxShape3D::project_range(const Vector3 &p_normal, const Transform3D &p_transform, real_t &r_min, real_t &r_max) const {
-	// no matter the angle, the box is mirrored anyway
-	Vector3 local_normal = p_transform.basis.xform_inv(p_normal);
-
-	real_t length = local_normal.abs().dot(half_extents);
-	real_t distance = p_normal.dot(p_transform.origin);
-
-	r_min = distance - length;
-	r_max = distance + length;
-}
-
 Vector3 GodotBoxShape3D::get_support(const Vector3 &p_normal) const {
 	Vector3 point(
 			(p_normal.x < 0) ? -half_extents.x : half_extents.x,
@@ -503,17 +481,6 @@ GodotBoxShape3D::GodotBoxShape3D() {}
 
 /********** CAPSULE *************/
 
-void GodotCapsuleShape3D::project_range(const Vector3 &p_normal, const Transform3D &p_transform, real_t &r_min, real_t &r_max) const {
-	Vector3 n = p_transform.basis.xform_inv(p_normal).normalized();
-	real_t h = height * 0.5 - radius;
-
-	n *= radius;
-	n.y += (n.y > 0) ? h : -h;
-
-	r_max = p_normal.dot(p_transform.xform(n));
-	r_min = p_normal.dot(p_transform.xform(-n));
-}
-
 Vector3 GodotCapsuleShape3D::get_support(const Vector3 &p_normal) const {
 	Vector3 n = p_normal;
 
@@ -666,28 +633,6 @@ GodotCapsuleShape3D::GodotCapsuleShape3D() {}
 
 /********** CYLINDER *************/
 
-void GodotCylinderShape3D::project_range(const Vector3 &p_normal, const Transform3D &p_transform, real_t &r_min, real_t &r_max) const {
-	Vector3 cylinder_axis = p_transform.basis.get_column(1).normalized();
-	real_t axis_dot = cylinder_axis.dot(p_normal);
-
-	Vector3 local_normal = p_transform.basis.xform_inv(p_normal);
-	real_t scale = local_normal.length();
-	real_t scaled_radius = radius * scale;
-	real_t scaled_height = height * scale;
-
-	real_t length;
-	if (Math::abs(axis_dot) > 1.0) {
-		length = scaled_height * 0.5;
-	} else {
-		length = Math::abs(axis_dot * scaled_height * 0.5) + scaled_radius * Math::sqrt(1.0 - axis_dot * axis_dot);
-	}
-
-	real_t distance = p_normal.dot(p_transform.origin);
-
-	r_min = distance - length;
-	r_max = distance + length;
-}
-
 Vector3 GodotCylinderShape3D::get_support(const Vector3 &p_normal) const {
 	Vector3 n = p_normal;
 	real_t h = (n.y > 0) ? height : -height;
@@ -1348,12 +1293,12 @@ Vector3 GodotConcavePolygonShape3D::get_support(const Vector3 &p_normal) const {
 void GodotConcavePolygonShape3D::_cull_segment(int p_idx, _SegmentCullParams *p_params) const {
 	const BVH *params_bvh = &p_params->bvh[p_idx];
 
-	if (!params_bvh->aabb.intersects_segment(p_params->from, p_params->to)) {
+	if (!_dequantize_aabb(*params_bvh).intersects_segment(p_params->from, p_params->to)) {
 		return;
 	}
 
-	if (params_bvh->face_index >= 0) {
-		const Face *f = &p_params->faces[params_bvh->face_index];
+	if (params_bvh->is_leaf()) {
+		const Face *f = &p_params->faces[params_bvh->get_face_index()];
 		GodotFaceShape3D *face = p_params->face;
 		face->normal = f->normal;
 		face->vertex[0] = p_params->vertices[f->indices[0]];
@@ -1362,7 +1307,7 @@ void GodotConcavePolygonShape3D::_cull_segment(int p_idx, _SegmentCullParams *p_
 
 		Vector3 res;
 		Vector3 normal;
-		int face_index = params_bvh->face_index;
+		int face_index = params_bvh->get_face_index();
 		if (face->intersect_segment(p_params->from, p_params->to, res, normal, face_index, true)) {
 			real_t d = p_params->dir.dot(res) - p_params->dir.dot(p_params->from);
 			if ((d > 0) && (d < p_params->min_d)) {
@@ -1374,12 +1319,8 @@ void GodotConcavePolygonShape3D::_cull_segment(int p_idx, _SegmentCullParams *p_
 			}
 		}
 	} else {
-		if (params_bvh->left >= 0) {
-			_cull_segment(params_bvh->left, p_params);
-		}
-		if (params_bvh->right >= 0) {
-			_cull_segment(params_bvh->right, p_params);
-		}
+		_cull_segment(p_idx + 1, p_params);
+		_cull_segment(params_bvh->data, p_params);
 	}
 }
 
@@ -1431,12 +1372,14 @@ Vector3 GodotConcavePolygonShape3D::get_closest_point_to(const Vector3 &p_point)
 bool GodotConcavePolygonShape3D::_cull(int p_idx, _CullParams *p_params) const {
 	const BVH *params_bvh = &p_params->bvh[p_idx];
 
-	if (!p_params->aabb.intersects(params_bvh->aabb)) {
-		return false;
+	for (int i = 0; i < 3; i++) {
+		if (p_params->aabb_min[i] > params_bvh->aabb_max[i] || p_params->aabb_max[i] < params_bvh->aabb_min[i]) {
+			return false;
+		}
 	}
 
-	if (params_bvh->face_index >= 0) {
-		const Face *f = &p_params->faces[params_bvh->face_index];
+	if (params_bvh->is_leaf()) {
+		const Face *f = &p_params->faces[params_bvh->get_face_index()];
 		GodotFaceShape3D *face = p_params->face;
 		face->normal = f->normal;
 		face->vertex[0] = p_params->vertices[f->indices[0]];
@@ -1446,16 +1389,12 @@ bool GodotConcavePolygonShape3D::_cull(int p_idx, _CullParams *p_params) const {
 			return true;
 		}
 	} else {
-		if (params_bvh->left >= 0) {
-			if (_cull(params_bvh->left, p_params)) {
-				return true;
-			}
+		if (_cull(p_idx + 1, p_params)) {
+			return true;
 		}
 
-		if (params_bvh->right >= 0) {
-			if (_cull(params_bvh->right, p_params)) {
-				return true;
-			}
+		if (_cull(params_bvh->data, p_params)) {
+			return true;
 		}
 	}
 
@@ -1468,7 +1407,9 @@ void GodotConcavePolygonShape3D::cull(const AABB &p_local_aabb, QueryCallback p_
 		return;
 	}
 
-	AABB local_aabb = p_local_aabb;
+	if (!p_local_aabb.intersects(get_aabb())) {
+		return;
+	}
 
 	// unlock data
 	const Face *fr = faces.ptr();
@@ -1480,7 +1421,7 @@ void GodotConcavePolygonShape3D::cull(const AABB &p_local_aabb, QueryCallback p_
 	face.invert_backface_collision = p_invert_backface_collision;
 
 	_CullParams params;
-	params.aabb = local_aabb;
+	_quantize_aabb(p_local_aabb, params.aabb_min, params.aabb_max);
 	params.face = &face;
 	params.faces = fr;
 	params.vertices = vr;
@@ -1586,24 +1527,17 @@ _Volume_BVH *_volume_build_bvh(_Volume_BVH_Element *p_elements, int p_size, int
 void GodotConcavePolygonShape3D::_fill_bvh(_Volume_BVH *p_bvh_tree, BVH *p_bvh_array, int &p_idx) {
 	int idx = p_idx;
 
-	p_bvh_array[idx].aabb = p_bvh_tree->aabb;
-	p_bvh_array[idx].face_index = p_bvh_tree->face_index;
-	//printf("%p - %i: %i(%p)  -- %p:%p\n",%p_bvh_array[idx],p_idx,p_bvh_array[i]->face_index,&p_bvh_tree->face_index,p_bvh_tree->left,p_bvh_tree->right);
-
-	if (p_bvh_tree->left) {
-		p_bvh_array[idx].left = ++p_idx;
-		_fill_bvh(p_bvh_tree->left, p_bvh_array, p_idx);
+	_quantize_aabb(p_bvh_tree->aabb, p_bvh_array[idx].aabb_min, p_bvh_array[idx].aabb_max);
 
+	if (p_bvh_tree->face_index >= 0) {
+		p_bvh_array[idx].data = ~p_bvh_tree->face_index;
 	} else {
-		p_bvh_array[p_idx].left = -1;
-	}
+		// Branches always have both children, the left one is stored right after the branch.
+		++p_idx;
+		_fill_bvh(p_bvh_tree->left, p_bvh_array, p_idx);
 
-	if (p_bvh_tree->right) {
-		p_bvh_array[idx].right = ++p_idx;
+		p_bvh_array[idx].data = ++p_idx;
 		_fill_bvh(p_bvh_tree->right, p_bvh_array, p_idx);
-
-	} else {
-		p_bvh_array[p_idx].right = -1;
 	}
 
 	memdelete(p_bvh_tree);
@@ -1657,7 +1591,13 @@ void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_b
 	int count = 0;
 	_Volume_BVH *bvh_tree = _volume_build_bvh(bvh_arrayw, src_face_count, count);
 
-	bvh.resize(count + 1);
+	bvh.resize(count);
+
+	bvh_origin = _aabb.position;
+	for (int i = 0; i < 3; i++) {
+		bvh_quantize_scale[i] = _aabb.size[i] > CMP_EPSILON ? 65535.0 / _aabb.size[i] : 0.0;
+		bvh_dequantize_scale[i] = _aabb.size[i] / 65535.0;
+	}
 
 	BVH *bvh_arrayw2 = bvh.ptrw();
 
@@ -1769,39 +1709,34 @@ _FORCE_INLINE_ bool _heightmap_cell_cull_segment(_HeightmapSegmentCullParams &p_
 	return false;
 }
 
-_FORCE_INLINE_ bool _heightmap_chunk_cull_segment(_HeightmapSegmentCullParams &p_params, const _HeightmapGridCullState &p_state) {
-	const GodotHeightMapShape3D::Range &chunk = p_params.heightmap->_get_bounds_chunk(p_state.x, p_state.z);
+// Clips the segment p_from + t * p_delta, t in [0, 1], against a box.
+_FORCE_INLINE_ bool _heightmap_clip_segment(const Vector3 &p_from, const Vector3 &p_delta, const Vector3 &p_min, const Vector3 &p_max, real_t &r_t0, real_t &r_t1) {
+	r_t0 = 0.0;
+	r_t1 = 1.0;
 
-	Vector3 enter_pos;
-	Vector3 exit_pos;
-
-	if (p_state.length_flat > CMP_EPSILON) {
-		real_t flat_to_3d = p_state.length / p_state.length_flat;
-		real_t enter_param = p_state.prev_dist * flat_to_3d;
-		real_t exit_param = p_state.dist * flat_to_3d;
-		enter_pos = p_params.from + p_params.dir * enter_param;
-		exit_pos = p_params.from + p_params.dir * exit_param;
-	} else {
-		// Consider the ray vertical.
-		// (though we shouldn't reach this often because there is an early check up-front)
-		enter_pos = p_params.from;
-		exit_pos = p_params.to;
-	}
+	for (int i = 0; i < 3; i++) {
+		if (Math::abs(p_delta[i]) < CMP_EPSILON) {
+			if (p_from[i] < p_min[i] || p_from[i] > p_max[i]) {
+				return false;
+			}
+			continue;
+		}
 
-	// Transform positions to heightmap space.
-	enter_pos *= GodotHeightMapShape3D::BOUNDS_CHUNK_SIZE;
-	exit_pos *= GodotHeightMapShape3D::BOUNDS_CHUNK_SIZE;
+		real_t inv_delta = 1.0 / p_delta[i];
+		real_t t_near = (p_min[i] - p_from[i]) * inv_delta;
+		real_t t_far = (p_max[i] - p_from[i]) * inv_delta;
+		if (t_near > t_far) {
+			SWAP(t_near, t_far);
+		}
 
-	// We did enter the flat projection of the AABB,
-	// but we have to check if we intersect it on the vertical axis.
-	if ((enter_pos.y > chunk.max) && (exit_pos.y > chunk.max)) {
-		return false;
-	}
-	if ((enter_pos.y < chunk.min) && (exit_pos.y < chunk.min)) {
-		return false;
+		r_t0 = MAX(r_t0, t_near);
+		r_t1 = MIN(r_t1, t_far);
+		if (r_t0 > r_t1) {
+			return false;
+		}
 	}
 
-	return p_params.heightmap->_intersect_grid_segment(_heightmap_cell_cull_segment, enter_pos, exit_pos, p_params.heightmap->width, p_params.heightmap->depth, p_params.heightmap->local_origin, p_params.result, p_params.normal);
+	return true;
 }
 
 template <typename ProcessFunction>
@@ -1981,7 +1916,7 @@ bool GodotHeightMapShape3D::intersect_segment(const Vector3 &p_begin, const Vect
 			r_normal = params.normal;
 			return true;
 		}
-	} else if (bounds_grid.is_empty()) {
+	} else if (bounds_levels.is_empty()) {
 		// Process all cells intersecting the flat projection of the ray.
 		return _intersect_grid_segment(_heightmap_cell_cull_segment, p_begin, p_end, width, depth, local_origin, r_point, r_normal);
 	} else {
@@ -1991,11 +1926,53 @@ bool GodotHeightMapShape3D::intersect_segment(const Vector3 &p_begin, const Vect
 			// Don't use chunks, the ray is too short in the plane.
 			return _intersect_grid_segment(_heightmap_cell_cull_segment, p_begin, p_end, width, depth, local_origin, r_point, r_normal);
 		} else {
-			// The ray is long, run raycast on a higher-level grid.
-			Vector3 bounds_from = p_begin / BOUNDS_CHUNK_SIZE;
-			Vector3 bounds_to = p_end / BOUNDS_CHUNK_SIZE;
-			Vector3 bounds_offset = local_origin / BOUNDS_CHUNK_SIZE;
-			return _intersect_grid_segment(_heightmap_chunk_cull_segment, bounds_from, bounds_to, bounds_grid_width, bounds_grid_depth, bounds_offset, r_point, r_normal);
+			// The ray is long, descend the quadtree from its root and only walk the cells of the chunks it can hit.
+			return _intersect_bounds_segment(bounds_levels.size() - 1, 0, 0, p_begin, p_end, r_point, r_normal);
+		}
+	}
+
+	return false;
+}
+
+bool GodotHeightMapShape3D::_intersect_bounds_segment(int p_level, int p_x, int p_z, const Vector3 &p_begin, const Vector3 &p_end, Vector3 &r_point, Vector3 &r_normal) const {
+	const Range &range = _get_bounds(p_level, p_x, p_z);
+	const int size = BOUNDS_CHUNK_SIZE << p_level;
+
+	// The small vertical margin keeps a non-zero clipped segment when the chunk is flat.
+	Vector3 node_min(p_x * size, range.min - 0.01, p_z * size);
+	Vector3 node_max(MIN((p_x + 1) * size, width - 1), range.max + 0.01, MIN((p_z + 1) * size, depth - 1));
+	node_min -= local_origin;
+	node_max -= local_origin;
+
+	Vector3 delta = p_end - p_begin;
+	real_t t0, t1;
+	if (!_heightmap_clip_segment(p_begin, delta, node_min, node_max, t0, t1)) {
+		return false;
+	}
+
+	if (p_level == 0) {
+		return _intersect_grid_segment(_heightmap_cell_cull_segment, p_begin + delta * t0, p_begin + delta * t1, width, depth, local_origin, r_point, r_normal);
+	}
+
+	// A segment crosses at most three of the four children, visiting them in this order is front to back.
+	const int near_x = (delta.x < 0.0) ? 1 : 0;
+	const int near_z = (delta.z < 0.0) ? 1 : 0;
+	const int order[4][2] = {
+		{ near_x, near_z },
+		{ 1 - near_x, near_z },
+		{ near_x, 1 - near_z },
+		{ 1 - near_x, 1 - near_z },
+	};
+
+	const BoundsLevel &child_level = bounds_levels[p_level - 1];
+	for (int i = 0; i < 4; i++) {
+		int child_x = p_x * 2 + order[i][0];
+		int child_z = p_z * 2 + order[i][1];
+		if (child_x >= child_level.width || child_z >= child_level.depth) {
+			continue;
+		}
+		if (_intersect_bounds_segment(p_level - 1, child_x, child_z, p_begin, p_end, r_point, r_normal)) {
+			return true;
 		}
 	}
 
@@ -2053,26 +2030,81 @@ void GodotHeightMapShape3D::cull(const AABB &p_local_aabb, QueryCallback p_callb
 	face.backface_collision = !p_invert_backface_collision;
 	face.invert_backface_collision = p_invert_backface_collision;
 
-	for (int z = start_z; z < end_z; z++) {
-		for (int x = start_x; x < end_x; x++) {
+	if (bounds_levels.is_empty()) {
+		_cull_cells(start_x, end_x, start_z, end_z, local_aabb, face, p_callback, p_userdata);
+	} else {
+		_cull_bounds(bounds_levels.size() - 1, 0, 0, start_x, end_x, start_z, end_z, local_aabb, face, p_callback, p_userdata);
+	}
+}
+
+bool GodotHeightMapShape3D::_cull_cells(int p_start_x, int p_end_x, int p_start_z, int p_end_z, const AABB &p_local_aabb, GodotFaceShape3D &p_face, QueryCallback p_callback, void *p_userdata) const {
+	const real_t aabb_min_y = p_local_aabb.position.y;
+	const real_t aabb_max_y = p_local_aabb.position.y + p_local_aabb.size.y;
+
+	for (int z = p_start_z; z < p_end_z; z++) {
+		for (int x = p_start_x; x < p_end_x; x++) {
+			// Skip cells that are entirely above or below the query.
+			real_t h00 = _get_height(x, z);
+			real_t h10 = _get_height(x + 1, z);
+			real_t h01 = _get_height(x, z + 1);
+			real_t h11 = _get_height(x + 1, z + 1);
+			if (MIN(MIN(h00, h10), MIN(h01, h11)) > aabb_max_y || MAX(MAX(h00, h10), MAX(h01, h11)) < aabb_min_y) {
+				continue;
+			}
+
 			// First triangle.
-			_get_point(x, z, face.vertex[0]);
-			_get_point(x + 1, z, face.vertex[1]);
-			_get_point(x, z + 1, face.vertex[2]);
-			face.normal = Plane(face.vertex[0], face.vertex[1], face.vertex[2]).normal;
-			if (p_callback(p_userdata, &face)) {
-				return;
+			_get_point(x, z, p_face.vertex[0]);
+			_get_point(x + 1, z, p_face.vertex[1]);
+			_get_point(x, z + 1, p_face.vertex[2]);
+			p_face.normal = Plane(p_face.vertex[0], p_face.vertex[1], p_face.vertex[2]).normal;
+			if (p_callback(p_userdata, &p_face)) {
+				return true;
 			}
 
 			// Second triangle.
-			face.vertex[0] = face.vertex[1];
-			_get_point(x + 1, z + 1, face.vertex[1]);
-			face.normal = Plane(face.vertex[0], face.vertex[1], face.vertex[2]).normal;
-			if (p_callback(p_userdata, &face)) {
-				return;
+			p_face.vertex[0] = p_face.vertex[1];
+			_get_point(x + 1, z + 1, p_face.vertex[1]);
+			p_face.normal = Plane(p_face.vertex[0], p_face.vertex[1], p_face.vertex[2]).normal;
+			if (p_callback(p_userdata, &p_face)) {
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+bool GodotHeightMapShape3D::_cull_bounds(int p_level, int p_x, int p_z, int p_start_x, int p_end_x, int p_start_z, int p_end_z, const AABB &p_local_aabb, GodotFaceShape3D &p_face, QueryCallback p_callback, void *p_userdata) const {
+	const Range &range = _get_bounds(p_level, p_x, p_z);
+	if (range.min > p_local_aabb.position.y + p_local_aabb.size.y || range.max < p_local_aabb.position.y) {
+		return false;
+	}
+
+	const int size = BOUNDS_CHUNK_SIZE << p_level;
+	int start_x = MAX(p_x * size, p_start_x);
+	int end_x = MIN((p_x + 1) * size, p_end_x);
+	int start_z = MAX(p_z * size, p_start_z);
+	int end_z = MIN((p_z + 1) * size, p_end_z);
+	if (start_x >= end_x || start_z >= end_z) {
+		return false;
+	}
+
+	if (p_level == 0) {
+		return _cull_cells(start_x, end_x, start_z, end_z, p_local_aabb, p_face, p_callback, p_userdata);
+	}
+
+	const BoundsLevel &child_level = bounds_levels[p_level - 1];
+	int child_end_x = MIN(p_x * 2 + 2, child_level.width);
+	int child_end_z = MIN(p_z * 2 + 2, child_level.depth);
+	for (int child_z = p_z * 2; child_z < child_end_z; child_z++) {
+		for (int child_x = p_x * 2; child_x < child_end_x; child_x++) {
+			if (_cull_bounds(p_level - 1, child_x, child_z, start_x, end_x, start_z, end_z, p_local_aabb, p_face, p_callback, p_userdata)) {
+				return true;
 			}
 		}
 	}
+
+	return false;
 }
 
 Vector3 GodotHeightMapShape3D::get_moment_of_inertia(real_t p_mass) const {
@@ -2086,10 +2118,10 @@ Vector3 GodotHeightMapShape3D::get_moment_of_inertia(real_t p_mass) const {
 }
 
 void GodotHeightMapShape3D::_build_accelerator() {
-	bounds_grid.clear();
+	bounds_levels.clear();
 
-	bounds_grid_width = width / BOUNDS_CHUNK_SIZE;
-	bounds_grid_depth = depth / BOUNDS_CHUNK_SIZE;
+	int bounds_grid_width = width / BOUNDS_CHUNK_SIZE;
+	int bounds_grid_depth = depth / BOUNDS_CHUNK_SIZE;
 
 	if (width % BOUNDS_CHUNK_SIZE > 0) {
 		++bounds_grid_width; // In case terrain size isn't dividable by chunk size.
@@ -2106,6 +2138,10 @@ void GodotHeightMapShape3D::_build_accelerator() {
 		return;
 	}
 
+	bounds_levels.resize(1);
+	LocalVector<Range> &bounds_grid = bounds_levels[0].ranges;
+	bounds_levels[0].width = bounds_grid_width;
+	bounds_levels[0].depth = bounds_grid_depth;
 	bounds_grid.resize(bound_grid_size);
 
 	// Compute min and max height for all chunks.
@@ -2152,6 +2188,31 @@ void GodotHeightMapShape3D::_build_accelerator() {
 			bounds_grid[cx + cz * bounds_grid_width] = r;
 		}
 	}
+
+	// Merge 2x2 ranges into the next level of the quadtree until a single root range is left.
+	while (bounds_levels[bounds_levels.size() - 1].width > 1 || bounds_levels[bounds_levels.size() - 1].depth > 1) {
+		bounds_levels.resize(bounds_levels.size() + 1);
+		const BoundsLevel &prev = bounds_levels[bounds_levels.size() - 2];
+		BoundsLevel &level = bounds_levels[bounds_levels.size() - 1];
+
+		level.width = (prev.width + 1) / 2;
+		level.depth = (prev.depth + 1) / 2;
+		level.ranges.resize(level.width * level.depth);
+
+		for (int z = 0; z < level.depth; ++z) {
+			for (int x = 0; x < level.width; ++x) {
+				Range r = prev.ranges[(z * 2) * prev.width + x * 2];
+				for (int pz = z * 2; pz < MIN(z * 2 + 2, prev.depth); ++pz) {
+					for (int px = x * 2; px < MIN(x * 2 + 2, prev.width); ++px) {
+						const Range &child = prev.ranges[pz * prev.width + px];
+						r.min = MIN(r.min, child.min);
+						r.max = MAX(r.max, child.max);
+					}
+				}
+				level.ranges[z * level.width + x] = r;
+			}
+		}
+	}
 }
 
 void GodotHeightMapShape3D::_setup(const Vector<real_t> &p_heights, int p_width, int p_depth, real_t p_min_height, real_t p_max_height) {
@@ -177,7 +177,18 @@ public:
 
 	virtual PhysicsServer3D::ShapeType get_type() const override { return PhysicsServer3D::SHAPE_SPHERE; }
 
-	virtual void project_range(const Vector3 &p_normal, const Transform3D &p_transform, real_t &r_min, real_t &r_max) const override;
+	_FORCE_INLINE_ void project_range_inline(const Vector3 &p_normal, const Transform3D &p_transform, real_t &r_min, real_t &r_max) const {
+		real_t d = p_normal.dot(p_transform.origin);
+
+		// figure out scale at point
+		Vector3 local_normal = p_transform.basis.xform_inv(p_normal);
+		real_t scale = local_normal.length();
+
+		r_min = d - (radius)*scale;
+		r_max = d + (radius)*scale;
+	}
+
+	virtual void project_range(const Vector3 &p_normal, const Transform3D &p_transform, real_t &r_min, real_t &r_max) const override { project_range_inline(p_normal, p_transform, r_min, r_max); }
 	virtual Vector3 get_support(const Vector3 &p_normal) const override;
 	virtual void get_supports(const Vector3 &p_normal, int p_max, Vector3 *r_supports, int &r_amount, FeatureType &r_type) const override;
 	virtual bool intersect_segment(const Vector3 &p_begin, const Vector3 &p_end, Vector3 &r_result, Vector3 &r_normal, int &r_face_index, bool p_hit_back_faces) const override;
@@ -202,7 +213,18 @@ public:
 
 	virtual PhysicsServer3D::ShapeType get_type() const override { return PhysicsServer3D::SHAPE_BOX; }
 
-	virtual void project_range(const Vector3 &p_normal, const Transform3D &p_transform, real_t &r_min, real_t &r_max) const override;
+	_FORCE_INLINE_ void project_range_inline(const Vector3 &p_normal, const Transform3D &p_transform, real_t &r_min, real_t &r_max) const {
+		// no matter the angle, the box is mirrored anyway
+		Vector3 local_normal = p_transform.basis.xform_inv(p_normal);
+
+		real_t length = local_normal.abs().dot(half_extents);
+		real_t distance = p_normal.dot(p_transform.origin);
+
+		r_min = distance - length;
+		r_max = distance + length;
+	}
+
+	virtual void project_range(const Vector3 &p_normal, const Transform3D &p_transform, real_t &r_min, real_t &r_max) const override { project_range_inline(p_normal, p_transform, r_min, r_max); }
 	virtual Vector3 get_support(const Vector3 &p_normal) const override;
 	virtual void get_supports(const Vector3 &p_normal, int p_max, Vector3 *r_supports, int &r_amount, FeatureType &r_type) const override;
 	virtual bool intersect_segment(const Vector3 &p_begin, const Vector3 &p_end, Vector3 &r_result, Vector3 &r_normal, int &r_face_index, bool p_hit_back_faces) const override;
@@ -231,7 +253,18 @@ public:
 
 	virtual PhysicsServer3D::ShapeType get_type() const override { return PhysicsServer3D::SHAPE_CAPSULE; }
 
-	virtual void project_range(const Vector3 &p_normal, const Transform3D &p_transform, real_t &r_min, real_t &r_max) const override;
+	_FORCE_INLINE_ void project_range_inline(const Vector3 &p_normal, const Transform3D &p_transform, real_t &r_min, real_t &r_max) const {
+		Vector3 n = p_transform.basis.xform_inv(p_normal).normalized();
+		real_t h = height * 0.5 - radius;
+
+		n *= radius;
+		n.y += (n.y > 0) ? h : -h;
+
+		r_max = p_normal.dot(p_transform.xform(n));
+		r_min = p_normal.dot(p_transform.xform(-n));
+	}
+
+	virtual void project_range(const Vector3 &p_normal, const Transform3D &p_transform, real_t &r_min, real_t &r_max) const override { project_range_inline(p_normal, p_transform, r_min, r_max); }
 	virtual Vector3 get_support(const Vector3 &p_normal) const override;
 	virtual void get_supports(const Vector3 &p_normal, int p_max, Vector3 *r_supports, int &r_amount, FeatureType &r_type) const override;
 	virtual bool intersect_segment(const Vector3 &p_begin, const Vector3 &p_end, Vector3 &r_result, Vector3 &r_normal, int &r_face_index, bool p_hit_back_faces) const override;
@@ -260,7 +293,29 @@ public:
 
 	virtual PhysicsServer3D::ShapeType get_type() const override { return PhysicsServer3D::SHAPE_CYLINDER; }
 
-	virtual void project_range(const Vector3 &p_normal, const Transform3D &p_transform, real_t &r_min, real_t &r_max) const override;
+	_FORCE_INLINE_ void project_range_inline(const Vector3 &p_normal, const Transform3D &p_transform, real_t &r_min, real_t &r_max) const {
+		Vector3 cylinder_axis = p_transform.basis.get_column(1).normalized();
+		real_t axis_dot = cylinder_axis.dot(p_normal);
+
+		Vector3 local_normal = p_transform.basis.xform_inv(p_normal);
+		real_t scale = local_normal.length();
+		real_t scaled_radius = radius * scale;
+		real_t scaled_height = height * scale;
+
+		real_t length;
+		if (Math::abs(axis_dot) > 1.0) {
+			length = scaled_height * 0.5;
+		} else {
+			length = Math::abs(axis_dot * scaled_height * 0.5) + scaled_radius * Math::sqrt(1.0 - axis_dot * axis_dot);
+		}
+
+		real_t distance = p_normal.dot(p_transform.origin);
+
+		r_min = distance - length;
+		r_max = distance + length;
+	}
+
+	virtual void project_range(const Vector3 &p_normal, const Transform3D &p_transform, real_t &r_min, real_t &r_max) const override { project_range_inline(p_normal, p_transform, r_min, r_max); }
 	virtual Vector3 get_support(const Vector3 &p_normal) const override;
 	virtual void get_supports(const Vector3 &p_normal, int p_max, Vector3 *r_supports, int &r_amount, FeatureType &r_type) const override;
 	virtual bool intersect_segment(const Vector3 &p_begin, const Vector3 &p_end, Vector3 &r_result, Vector3 &r_normal, int &r_face_index, bool p_hit_back_faces) const override;
@@ -316,18 +371,41 @@ struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
 	Vector<Face> faces;
 	Vector<Vector3> vertices;
 
+	// Compact BVH node, stored depth first so the left child of a branch always follows it.
+	// Bounds are quantized to 16 bits over the shape AABB and rounded outwards.
 	struct BVH {
-		AABB aabb;
-		int left = 0;
-		int right = 0;
+		uint16_t aabb_min[3] = {};
+		uint16_t aabb_max[3] = {};
+		int32_t data = 0; // Index of the right child for a branch, ~face_index for a leaf.
 
-		int face_index = 0;
+		_FORCE_INLINE_ bool is_leaf() const { return data < 0; }
+		_FORCE_INLINE_ int get_face_index() const { return ~data; }
 	};
 
 	Vector<BVH> bvh;
+	Vector3 bvh_origin;
+	Vector3 bvh_quantize_scale;
+	Vector3 bvh_dequantize_scale;
+
+	_FORCE_INLINE_ void _quantize_aabb(const AABB &p_aabb, uint16_t *r_min, uint16_t *r_max) const {
+		Vector3 min = (p_aabb.position - bvh_origin) * bvh_quantize_scale;
+		Vector3 max = (p_aabb.position + p_aabb.size - bvh_origin) * bvh_quantize_scale;
+		for (int i = 0; i < 3; i++) {
+			// One extra step on each side covers the rounding error of the scaling.
+			r_min[i] = (uint16_t)CLAMP(Math::floor(min[i]) - 1.0, 0.0, 65535.0);
+			r_max[i] = (uint16_t)CLAMP(Math::ceil(max[i]) + 1.0, 0.0, 65535.0);
+		}
+	}
+
+	_FORCE_INLINE_ AABB _dequantize_aabb(const BVH &p_node) const {
+		Vector3 min(p_node.aabb_min[0], p_node.aabb_min[1], p_node.aabb_min[2]);
+		Vector3 max(p_node.aabb_max[0], p_node.aabb_max[1], p_node.aabb_max[2]);
+		return AABB(bvh_origin + min * bvh_dequantize_scale, (max - min) * bvh_dequantize_scale);
+	}
 
 	struct _CullParams {
-		AABB aabb;
+		uint16_t aabb_min[3] = {};
+		uint16_t aabb_max[3] = {};
 		QueryCallback callback = nullptr;
 		void *userdata = nullptr;
 		const Face *faces = nullptr;
@@ -389,19 +467,25 @@ struct GodotHeightMapShape3D : public GodotConcaveShape3D {
 	int depth = 0;
 	Vector3 local_origin;
 
-	// Accelerator.
+	// Accelerator: min/max height quadtree.
+	// Level 0 stores the height range of each chunk of BOUNDS_CHUNK_SIZE cells,
+	// every next level merges 2x2 ranges of the previous one, up to a single root range.
 	struct Range {
 		real_t min = 0.0;
 		real_t max = 0.0;
 	};
-	LocalVector<Range> bounds_grid;
-	int bounds_grid_width = 0;
-	int bounds_grid_depth = 0;
+	struct BoundsLevel {
+		LocalVector<Range> ranges;
+		int width = 0;
+		int depth = 0;
+	};
+	LocalVector<BoundsLevel> bounds_levels;
 
 	static const int BOUNDS_CHUNK_SIZE = 16;
 
-	_FORCE_INLINE_ const Range &_get_bounds_chunk(int p_x, int p_z) const {
-		return bounds_grid[(p_z * bounds_grid_width) + p_x];
+	_FORCE_INLINE_ const Range &_get_bounds(int p_level, int p_x, int p_z) const {
+		const BoundsLevel &level = bounds_levels[p_level];
+		return level.ranges[(p_z * level.width) + p_x];
 	}
 
 	_FORCE_INLINE_ real_t _get_height(int p_x, int p_z) const {
@@ -420,6 +504,9 @@ struct GodotHeightMapShape3D : public GodotConcaveShape3D {
 
 	template <typename ProcessFunction>
 	bool _intersect_grid_segment(ProcessFunction &p_process, const Vector3 &p_begin, const Vector3 &p_end, int p_width, int p_depth, const Vector3 &offset, Vector3 &r_point, Vector3 &r_normal) const;
+	bool _intersect_bounds_segment(int p_level, int p_x, int p_z, const Vector3 &p_begin, const Vector3 &p_end, Vector3 &r_point, Vector3 &r_normal) const;
+	bool _cull_cells(int p_start_x, int p_end_x, int p_start_z, int p_end_z, const AABB &p_local_aabb, GodotFaceShape3D &p_face, QueryCallback p_callback, void *p_userdata) const;
+	bool _cull_bounds(int p_level, int p_x, int p_z, int p_start_x, int p_end_x, int p_start_z, int p_end_z, const AABB &p_local_aabb, GodotFaceShape3D &p_face, QueryCallback p_callback, void *p_userdata) const;
 
 	void _setup(const Vector<real_t> &p_heights, int p_width, int p_depth, real_t p_min_height, real_t p_max_height);
 
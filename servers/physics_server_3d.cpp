@@ -476,6 +476,196 @@ Dictionary PhysicsDirectSpaceState3D::_get_rest_info(const Ref<PhysicsShapeQuery
 	return r;
 }
 
+Dictionary PhysicsDirectSpaceState3D::_intersect_rays(const Ref<PhysicsRayQueryParameters3D> &p_ray_query, const PackedVector3Array &p_from, const PackedVector3Array &p_to, const PackedInt32Array &p_collision_masks) {
+	ERR_FAIL_COND_V(!p_ray_query.is_valid(), Dictionary());
+	ERR_FAIL_COND_V_MSG(p_from.size() != p_to.size(), Dictionary(), "The \"from\" and \"to\" arrays must have the same size.");
+	ERR_FAIL_COND_V_MSG(!p_collision_masks.is_empty() && p_collision_masks.size() != p_from.size(), Dictionary(), "The collision mask array must be empty or have one mask per ray.");
+
+	int count = p_from.size();
+
+	Vector<RayResult> results;
+	results.resize(count);
+	Vector<bool> hits;
+	hits.resize(count);
+
+	intersect_rays(p_ray_query->get_parameters(), p_from.ptr(), p_to.ptr(), p_collision_masks.is_empty() ? nullptr : reinterpret_cast<const uint32_t *>(p_collision_masks.ptr()), count, results.ptrw(), hits.ptrw());
+
+	PackedByteArray hit_flags;
+	hit_flags.resize(count);
+	PackedVector3Array positions;
+	positions.resize(count);
+	PackedVector3Array normals;
+	normals.resize(count);
+	PackedInt32Array face_indices;
+	face_indices.resize(count);
+	PackedInt64Array collider_ids;
+	collider_ids.resize(count);
+	PackedInt32Array shapes;
+	shapes.resize(count);
+	TypedArray<RID> rids;
+	rids.resize(count);
+
+	uint8_t *hit_flags_w = hit_flags.ptrw();
+	Vector3 *positions_w = positions.ptrw();
+	Vector3 *normals_w = normals.ptrw();
+	int32_t *face_indices_w = face_indices.ptrw();
+	int64_t *collider_ids_w = collider_ids.ptrw();
+	int32_t *shapes_w = shapes.ptrw();
+
+	for (int i = 0; i < count; i++) {
+		hit_flags_w[i] = hits[i];
+		if (!hits[i]) {
+			positions_w[i] = Vector3();
+			normals_w[i] = Vector3();
+			face_indices_w[i] = -1;
+			collider_ids_w[i] = 0;
+			shapes_w[i] = -1;
+			continue;
+		}
+
+		const RayResult &result = results[i];
+		positions_w[i] = result.position;
+		normals_w[i] = result.normal;
+		face_indices_w[i] = result.face_index;
+		collider_ids_w[i] = int64_t(result.collider_id);
+		shapes_w[i] = result.shape;
+		rids[i] = result.rid;
+	}
+
+	Dictionary d;
+	d["hit"] = hit_flags;
+	d["position"] = positions;
+	d["normal"] = normals;
+	d["face_index"] = face_indices;
+	d["collider_id"] = collider_ids;
+	d["shape"] = shapes;
+	d["rid"] = rids;
+
+	return d;
+}
+
+Dictionary PhysicsDirectSpaceState3D::_intersect_shapes(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query, const TypedArray<Transform3D> &p_transforms, int p_max_results) {
+	ERR_FAIL_COND_V(!p_shape_query.is_valid(), Dictionary());
+	ERR_FAIL_COND_V(p_max_results <= 0, Dictionary());
+
+	int count = p_transforms.size();
+
+	Vector<Transform3D> transforms;
+	transforms.resize(count);
+	for (int i = 0; i < count; i++) {
+		transforms.write[i] = p_transforms[i];
+	}
+
+	Vector<ShapeResult> sr;
+	sr.resize(count * p_max_results);
+	PackedInt32Array counts;
+	counts.resize(count);
+
+	intersect_shapes(p_shape_query->get_parameters(), transforms.ptr(), count, sr.ptrw(), p_max_results, counts.ptrw());
+
+	int total = 0;
+	for (int i = 0; i < count; i++) {
+		total += counts[i];
+	}
+
+	PackedInt64Array collider_ids;
+	collider_ids.resize(total);
+	PackedInt32Array shapes;
+	shapes.resize(total);
+	TypedArray<RID> rids;
+	rids.resize(total);
+
+	int64_t *collider_ids_w = collider_ids.ptrw();
+	int32_t *shapes_w = shapes.ptrw();
+
+	int idx = 0;
+	for (int i = 0; i < count; i++) {
+		const ShapeResult *query_results = &sr[i * p_max_results];
+		for (int j = 0; j < counts[i]; j++) {
+			collider_ids_w[idx] = int64_t(query_results[j].collider_id);
+			shapes_w[idx] = query_results[j].shape;
+			rids[idx] = query_results[j].rid;
+			idx++;
+		}
+	}
+
+	Dictionary d;
+	d["count"] = counts;
+	d["collider_id"] = collider_ids;
+	d["shape"] = shapes;
+	d["rid"] = rids;
+
+	return d;
+}
+
+Vector<real_t> PhysicsDirectSpaceState3D::_cast_motions(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query, const TypedArray<Transform3D> &p_transforms, const PackedVector3Array &p_motions) {
+	ERR_FAIL_COND_V(!p_shape_query.is_valid(), Vector<real_t>());
+	ERR_FAIL_COND_V_MSG(!p_motions.is_empty() && p_motions.size() != p_transforms.size(), Vector<real_t>(), "The motion array must be empty or have one motion per transform.");
+
+	int count = p_transforms.size();
+
+	Vector<Transform3D> transforms;
+	transforms.resize(count);
+	for (int i = 0; i < count; i++) {
+		transforms.write[i] = p_transforms[i];
+	}
+
+	Vector<real_t> closest_safe;
+	closest_safe.resize(count);
+	Vector<real_t> closest_unsafe;
+	closest_unsafe.resize(count);
+
+	bool res = cast_motions(p_shape_query->get_parameters(), transforms.ptr(), p_motions.is_empty() ? nullptr : p_motions.ptr(), count, closest_safe.ptrw(), closest_unsafe.ptrw());
+	if (!res) {
+		return Vector<real_t>();
+	}
+
+	Vector<real_t> ret;
+	ret.resize(count * 2);
+	real_t *ret_w = ret.ptrw();
+	for (int i = 0; i < count; i++) {
+		ret_w[i * 2 + 0] = closest_safe[i];
+		ret_w[i * 2 + 1] = closest_unsafe[i];
+	}
+	return ret;
+}
+
+void PhysicsDirectSpaceState3D::intersect_rays(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, const uint32_t *p_collision_masks, int p_count, RayResult *r_results, bool *r_hits) {
+	RayParameters parameters = p_parameters;
+	for (int i = 0; i < p_count; i++) {
+		parameters.from = p_from[i];
+		parameters.to = p_to[i];
+		if (p_collision_masks) {
+			parameters.collision_mask = p_collision_masks[i];
+		}
+		r_hits[i] = intersect_ray(parameters, r_results[i]);
+	}
+}
+
+void PhysicsDirectSpaceState3D::intersect_shapes(const ShapeParameters &p_parameters, const Transform3D *p_transforms, int p_count, ShapeResult *r_results, int p_result_max, int *r_result_counts) {
+	ShapeParameters parameters = p_parameters;
+	for (int i = 0; i < p_count; i++) {
+		parameters.transform = p_transforms[i];
+		r_result_counts[i] = intersect_shape(parameters, &r_results[i * p_result_max], p_result_max);
+	}
+}
+
+bool PhysicsDirectSpaceState3D::cast_motions(const ShapeParameters &p_parameters, const Transform3D *p_transforms, const Vector3 *p_motions, int p_count, real_t *r_closest_safe, real_t *r_closest_unsafe) {
+	ShapeParameters parameters = p_parameters;
+	for (int i = 0; i < p_count; i++) {
+		parameters.transform = p_transforms[i];
+		if (p_motions) {
+			parameters.motion = p_motions[i];
+		}
+		r_closest_safe[i] = 1.0;
+		r_closest_unsafe[i] = 1.0;
+		if (!cast_motion(parameters, r_closest_safe[i], r_closest_unsafe[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
 PhysicsDirectSpaceState3D::PhysicsDirectSpaceState3D() {
 }
 
@@ -486,6 +676,10 @@ void PhysicsDirectSpaceState3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("cast_motion", "parameters"), &PhysicsDirectSpaceState3D::_cast_motion);
 	ClassDB::bind_method(D_METHOD("collide_shape", "parameters", "max_results"), &PhysicsDirectSpaceState3D::_collide_shape, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("get_rest_info", "parameters"), &PhysicsDirectSpaceState3D::_get_rest_info);
+
+	ClassDB::bind_method(D_METHOD("intersect_rays", "parameters", "from", "to", "collision_masks"), &PhysicsDirectSpaceState3D::_intersect_rays, DEFVAL(PackedInt32Array()));
+	ClassDB::bind_method(D_METHOD("intersect_shapes", "parameters", "transforms", "max_results"), &PhysicsDirectSpaceState3D::_intersect_shapes, DEFVAL(32));
+	ClassDB::bind_method(D_METHOD("cast_motions", "parameters", "transforms", "motions"), &PhysicsDirectSpaceState3D::_cast_motions, DEFVAL(PackedVector3Array()));
 }
 
 ///////////////////////////////
@@ -1110,6 +1304,10 @@ void PhysicsServer3D::_bind_methods() {
 	BIND_ENUM_CONSTANT(SPACE_PARAM_BODY_ANGULAR_VELOCITY_SLEEP_THRESHOLD);
 	BIND_ENUM_CONSTANT(SPACE_PARAM_BODY_TIME_TO_SLEEP);
 	BIND_ENUM_CONSTANT(SPACE_PARAM_SOLVER_ITERATIONS);
+	BIND_ENUM_CONSTANT(SPACE_PARAM_SOLVER_TYPE);
+
+	BIND_ENUM_CONSTANT(SPACE_SOLVER_TYPE_SEQUENTIAL_IMPULSE);
+	BIND_ENUM_CONSTANT(SPACE_SOLVER_TYPE_BLOCK);
 
 	BIND_ENUM_CONSTANT(BODY_AXIS_LINEAR_X);
 	BIND_ENUM_CONSTANT(BODY_AXIS_LINEAR_Y);
@@ -1135,6 +1333,7 @@ PhysicsServer3D::PhysicsServer3D() {
 	GLOBAL_DEF("physics/3d/sleep_threshold_angular", Math::deg_to_rad(8.0));
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/time_before_sleep", PROPERTY_HINT_RANGE, "0,5,0.01,or_greater"), 0.5);
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "physics/3d/solver/solver_iterations", PROPERTY_HINT_RANGE, "1,32,1,or_greater"), 16);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "physics/3d/solver/solver_type", PROPERTY_HINT_ENUM, "Sequential Impulse,Block"), 0);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/solver/contact_recycle_radius", PROPERTY_HINT_RANGE, "0,0.1,0.001,or_greater"), 0.01);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/solver/contact_max_separation", PROPERTY_HINT_RANGE, "0,0.1,0.001,or_greater"), 0.05);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/solver/contact_max_allowed_penetration", PROPERTY_HINT_RANGE, "0.001,0.1,0.001,or_greater"), 0.01);
@@ -129,6 +129,9 @@ private:
 	Vector<real_t> _cast_motion(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query);
 	TypedArray<Vector3> _collide_shape(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query, int p_max_results = 32);
 	Dictionary _get_rest_info(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query);
+	Dictionary _intersect_rays(const Ref<PhysicsRayQueryParameters3D> &p_ray_query, const PackedVector3Array &p_from, const PackedVector3Array &p_to, const PackedInt32Array &p_collision_masks = PackedInt32Array());
+	Dictionary _intersect_shapes(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query, const TypedArray<Transform3D> &p_transforms, int p_max_results = 32);
+	Vector<real_t> _cast_motions(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query, const TypedArray<Transform3D> &p_transforms, const PackedVector3Array &p_motions = PackedVector3Array());
 
 protected:
 	static void _bind_methods();
@@ -207,6 +210,14 @@ public:
 
 	virtual Vector3 get_closest_point_to_object_volume(RID p_object, const Vector3 p_point) const = 0;
 
+	// Batched queries take their shared settings from p_parameters and the per-query values from the arrays.
+	// Optional arrays (collision masks, motions) may be null, in which case the value in p_parameters is used.
+	// The default implementations run the queries one after another.
+	virtual void intersect_rays(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, const uint32_t *p_collision_masks, int p_count, RayResult *r_results, bool *r_hits);
+	// Results of query i are stored from r_results[i * p_result_max].
+	virtual void intersect_shapes(const ShapeParameters &p_parameters, const Transform3D *p_transforms, int p_count, ShapeResult *r_results, int p_result_max, int *r_result_counts);
+	virtual bool cast_motions(const ShapeParameters &p_parameters, const Transform3D *p_transforms, const Vector3 *p_motions, int p_count, real_t *r_closest_safe, real_t *r_closest_unsafe);
+
 	PhysicsDirectSpaceState3D();
 };
 
@@ -296,6 +307,12 @@ public:
 		SPACE_PARAM_BODY_ANGULAR_VELOCITY_SLEEP_THRESHOLD,
 		SPACE_PARAM_BODY_TIME_TO_SLEEP,
 		SPACE_PARAM_SOLVER_ITERATIONS,
+		SPACE_PARAM_SOLVER_TYPE,
+	};
+
+	enum SpaceSolverType {
+		SPACE_SOLVER_TYPE_SEQUENTIAL_IMPULSE,
+		SPACE_SOLVER_TYPE_BLOCK,
 	};
 
 	virtual void space_set_param(RID p_space, SpaceParameter p_param, real_t p_value) = 0;
@@ -1039,6 +1056,7 @@ public:
 
 VARIANT_ENUM_CAST(PhysicsServer3D::ShapeType);
 VARIANT_ENUM_CAST(PhysicsServer3D::SpaceParameter);
+VARIANT_ENUM_CAST(PhysicsServer3D::SpaceSolverType);
 VARIANT_ENUM_CAST(PhysicsServer3D::AreaParameter);
 VARIANT_ENUM_CAST(PhysicsServer3D::AreaSpaceOverrideMode);
 VARIANT_ENUM_CAST(PhysicsServer3D::BodyMode);
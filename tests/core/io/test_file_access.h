@@ -107,6 +107,22 @@ TEST_CASE("[FileAccess] Get as UTF-8 String") {
 	CHECK(s_cr == "Hello darkness\rMy old friend\rI've come to talk\rWith you again\r");
 	CHECK(s_cr_nocr == "Hello darknessMy old friendI've come to talkWith you again");
 }
+
+TEST_CASE("[FileAccess] Mapped buffer") {
+	Ref<FileAccess> f = FileAccess::open(TestUtils::get_data_path("testdata.csv"), FileAccess::READ);
+	REQUIRE(!f.is_null());
+
+	const uint8_t *mapped = f->get_mapped_buffer();
+	if (!mapped) {
+		// Not every platform can map files, readers must fall back to get_buffer().
+		return;
+	}
+
+	Vector<uint8_t> data = f->get_buffer(f->get_length());
+	REQUIRE(data.size() == (int64_t)f->get_length());
+	CHECK_MESSAGE(memcmp(mapped, data.ptr(), data.size()) == 0, "The mapped view should match the file contents.");
+	CHECK_MESSAGE(f->get_mapped_buffer() == mapped, "The file should only be mapped once.");
+}
 } // namespace TestFileAccess
 
 #endif // TEST_FILE_ACCESS_H
@@ -386,6 +386,124 @@ TEST_CASE("[Marshalls] Typed array decoding") {
 	CHECK(array[0] == Variant(uint64_t(0x0f123456789abcdef)));
 }
 
+TEST_CASE("[Marshalls] Compact encoding") {
+	int r_len;
+	uint8_t buffer[16];
+
+	CHECK(encode_variant_compact(-3, buffer, r_len) == OK);
+	CHECK_MESSAGE(r_len == 2, "Length == 1 byte for tag + 1 byte for varint");
+	CHECK_MESSAGE(buffer[0] == 0x02, "Variant::INT");
+	CHECK_MESSAGE(buffer[1] == 0x05, "Zigzag encoded -3");
+
+	Array strings;
+	strings.push_back("ab");
+	strings.push_back("ab");
+	CHECK(encode_variant_compact(strings, buffer, r_len) == OK);
+	CHECK_MESSAGE(r_len == 10, "Repeated string should only be stored once");
+	CHECK_MESSAGE(buffer[0] == 0x1c, "Variant::ARRAY");
+	CHECK_MESSAGE(buffer[1] == 0x00, "Untyped");
+	CHECK_MESSAGE(buffer[2] == 0x02, "Array size");
+	CHECK_MESSAGE(buffer[3] == 0x04, "Variant::STRING");
+	CHECK_MESSAGE(buffer[4] == 0x00, "New string");
+	CHECK_MESSAGE(buffer[5] == 0x02, "String length");
+	CHECK(buffer[6] == 'a');
+	CHECK(buffer[7] == 'b');
+	CHECK_MESSAGE(buffer[8] == 0x04, "Variant::STRING");
+	CHECK_MESSAGE(buffer[9] == 0x01, "Index of the first string + 1");
+
+	Variant variant;
+	int decoded_len;
+	CHECK(decode_variant_compact(variant, buffer, r_len, &decoded_len) == OK);
+	CHECK(decoded_len == 10);
+	CHECK(variant == Variant(strings));
+}
+
+TEST_CASE("[Marshalls] Compact encoding round trip") {
+	Array typed;
+	typed.set_typed(Variant::INT, StringName(), Ref<Script>());
+	for (int i = 0; i < 16; i++) {
+		typed.push_back(i * 100);
+	}
+
+	Dictionary dict;
+	dict["health"] = 100;
+	dict["name"] = "player";
+	dict["alive"] = true;
+	dict["speed"] = 2.5;
+	dict["precise"] = 0.1;
+	dict[StringName("inventory")] = typed;
+	dict["position"] = Vector3(1, 2, 3);
+	dict["nothing"] = Variant();
+	dict[7] = "player";
+
+	int compact_len;
+	CHECK(encode_variant_compact(dict, nullptr, compact_len) == OK);
+	int regular_len;
+	CHECK(encode_variant(dict, nullptr, regular_len) == OK);
+	CHECK_MESSAGE(compact_len * 2 < regular_len, "Compact encoding should be less than half the size.");
+
+	Vector<uint8_t> buffer;
+	buffer.resize(compact_len);
+	int r_len;
+	CHECK(encode_variant_compact(dict, buffer.ptrw(), r_len) == OK);
+	CHECK(r_len == compact_len);
+
+	Variant variant;
+	CHECK(decode_variant_compact(variant, buffer.ptr(), buffer.size(), &r_len) == OK);
+	CHECK(r_len == compact_len);
+	CHECK(variant == Variant(dict));
+	Array decoded_typed = variant.operator Dictionary()[StringName("inventory")];
+	CHECK_MESSAGE(decoded_typed.get_typed_builtin() == Variant::INT, "Typed arrays should keep their type.");
+
+	ERR_PRINT_OFF;
+	CHECK_MESSAGE(decode_variant_compact(variant, buffer.ptr(), buffer.size() - 1) != OK, "Truncated data should fail to decode.");
+	ERR_PRINT_ON;
+}
+
+TEST_CASE("[Marshalls] Compact encoding with schema") {
+	Dictionary schema;
+	schema["x"] = Variant::INT;
+	schema["y"] = Variant::INT;
+	schema["name"] = Variant::STRING;
+
+	Dictionary dict;
+	dict["x"] = 12;
+	dict["y"] = -3;
+	dict["name"] = "Bob";
+
+	int r_len;
+	uint8_t buffer[16];
+	CHECK(encode_variant_compact(dict, buffer, r_len, schema) == OK);
+	CHECK_MESSAGE(r_len == 7, "Only the values should be stored, without tags");
+	CHECK_MESSAGE(buffer[0] == 0x18, "Zigzag encoded 12");
+	CHECK_MESSAGE(buffer[1] == 0x05, "Zigzag encoded -3");
+	CHECK_MESSAGE(buffer[2] == 0x00, "New string");
+	CHECK_MESSAGE(buffer[3] == 0x03, "String length");
+
+	Variant variant;
+	CHECK(decode_variant_compact(variant, buffer, r_len, nullptr, schema) == OK);
+	CHECK(variant == Variant(dict));
+
+	Array array_schema;
+	array_schema.push_back(schema);
+	Array array;
+	array.push_back(dict);
+	array.push_back(dict);
+	CHECK(encode_variant_compact(array, buffer, r_len, array_schema) == OK);
+	CHECK_MESSAGE(r_len == 11, "Length == 1 byte for size + 7 bytes for the first element + 3 bytes for the second, reusing the string");
+	CHECK(decode_variant_compact(variant, buffer, r_len, nullptr, array_schema) == OK);
+	CHECK(variant == Variant(array));
+
+	ERR_PRINT_OFF;
+	dict.erase("y");
+	dict["z"] = 1;
+	CHECK_MESSAGE(encode_variant_compact(dict, nullptr, r_len, schema) == ERR_INVALID_PARAMETER, "Keys that don't match the schema should be rejected.");
+	dict.erase("z");
+	dict["y"] = "not an int";
+	CHECK_MESSAGE(encode_variant_compact(dict, nullptr, r_len, schema) == ERR_INVALID_PARAMETER, "Types that don't match the schema should be rejected.");
+	ERR_PRINT_ON;
+}
+
 } // namespace TestMarshalls
 
 #endif // TEST_MARSHALLS_H
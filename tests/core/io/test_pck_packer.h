@@ -62,6 +62,11 @@ TEST_CASE("[PCKPacker] Pack an empty PCK file") {
 	CHECK_MESSAGE(
 			f->get_length() <= 500,
 			"The generated empty PCK file shouldn't be too large.");
+
+	f->seek(4);
+	CHECK_MESSAGE(
+			f->get_32() == PACK_FORMAT_VERSION_UNCOMPRESSED,
+			"A PCK file without compressed files should keep the format version older engine versions can read.");
 }
 
 TEST_CASE("[PCKPacker] Pack empty with zero alignment invalid") {
@@ -117,6 +122,69 @@ TEST_CASE("[PCKPacker] Pack a PCK file with some files and directories") {
 			f->get_length() <= 27000,
 			"The generated non-empty PCK file shouldn't be too large.");
 }
+
+TEST_CASE("[PCKPacker] Pack and read back a compressed file") {
+	// Several blocks plus a partial one, compressible but not uniform.
+	const int data_size = PACK_COMPRESSED_BLOCK_SIZE * 3 + 1234;
+	Vector<uint8_t> data;
+	data.resize(data_size);
+	for (int i = 0; i < data_size; i++) {
+		data.write[i] = (i / 7) % 251;
+	}
+
+	const String source_path = TestUtils::get_temp_path("compressed_source.bin");
+	{
+		Ref<FileAccess> f = FileAccess::open(source_path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_buffer(data);
+	}
+
+	PCKPacker pck_packer;
+	const String output_pck_path = TestUtils::get_temp_path("output_compressed.pck");
+	REQUIRE(pck_packer.pck_start(output_pck_path) == OK);
+	CHECK_MESSAGE(
+			pck_packer.add_file_compressed("res://test_pck_packer/compressed.bin", source_path, FileAccess::COMPRESSION_ZSTD) == OK,
+			"Adding a compressed file to the PCK should return an OK error code.");
+	REQUIRE(pck_packer.flush() == OK);
+
+	{
+		Ref<FileAccess> pck = FileAccess::open(output_pck_path, FileAccess::READ);
+		REQUIRE(pck.is_valid());
+		CHECK_MESSAGE(
+				pck->get_length() < (uint64_t)data_size,
+				"The PCK should be smaller than the data it holds once compressed.");
+		pck->seek(4);
+		CHECK_MESSAGE(
+				pck->get_32() == PACK_FORMAT_VERSION,
+				"A PCK file with compressed files should use the format version that supports them.");
+	}
+
+	REQUIRE(PackedData::get_singleton());
+	REQUIRE(PackedData::get_singleton()->add_pack(output_pck_path, true, 0) == OK);
+	Ref<FileAccess> f = PackedData::get_singleton()->try_open_path("res://test_pck_packer/compressed.bin");
+	REQUIRE(f.is_valid());
+	CHECK(f->get_length() == (uint64_t)data_size);
+
+	Vector<uint8_t> read_back = f->get_buffer(data_size);
+	CHECK_MESSAGE(read_back == data, "Reading the whole compressed file should return the original data.");
+
+	// Random access across a block boundary.
+	const uint64_t boundary = PACK_COMPRESSED_BLOCK_SIZE * 2;
+	f->seek(boundary - 10);
+	Vector<uint8_t> range = f->get_buffer(20);
+	REQUIRE(range.size() == 20);
+	bool range_matches = true;
+	for (int i = 0; i < 20; i++) {
+		range_matches = range_matches && range[i] == data[boundary - 10 + i];
+	}
+	CHECK_MESSAGE(range_matches, "Reading across a block boundary should return the original data.");
+
+	f->seek(12345);
+	CHECK(f->get_8() == data[12345]);
+	f->seek_end();
+	f->get_8();
+	CHECK(f->eof_reached());
+}
 } // namespace TestPCKPacker
 
 #endif // TEST_PCK_PACKER_H
@@ -31,10 +31,15 @@
 #ifndef TEST_RESOURCE_H
 #define TEST_RESOURCE_H
 
+#include "core/config/project_settings.h"
+#include "core/io/dir_access.h"
+#include "core/io/image.h"
 #include "core/io/resource.h"
+#include "core/io/resource_format_binary.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
 #include "core/os/os.h"
+#include "scene/resources/resource_format_text.h"
 
 #include "thirdparty/doctest/doctest.h"
 
@@ -166,6 +171,175 @@ TEST_CASE("[Resource] Breaking circular references on save") {
 	// Break circular reference to avoid memory leak
 	resource_c->remove_meta("next");
 }
+
+TEST_CASE("[Resource] Loading binary sub-resources with sub-threads") {
+	const int child_count = 64;
+	Ref<Resource> resource = memnew(Resource);
+	Array children;
+	Ref<Resource> previous;
+	for (int i = 0; i < child_count; i++) {
+		Ref<Resource> child = memnew(Resource);
+		child->set_name(itos(i));
+		PackedFloat32Array values;
+		values.resize(1000);
+		for (int j = 0; j < values.size(); j++) {
+			values.set(j, i + j);
+		}
+		child->set_meta("values", values);
+		if (previous.is_valid()) {
+			// References between sub-resources must survive decoding them out of order.
+			child->set_meta("previous", previous);
+		}
+		children.push_back(child);
+		previous = child;
+	}
+	resource->set_meta("children", children);
+
+	const String save_path = TestUtils::get_temp_path("resource_sub_threads.res");
+	REQUIRE(ResourceSaver::save(resource, save_path) == OK);
+
+	Ref<ResourceFormatLoaderBinary> loader;
+	loader.instantiate();
+	Error err = FAILED;
+	Ref<Resource> loaded = loader->load(save_path, save_path, &err, true, nullptr, ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(err == OK);
+	REQUIRE(loaded.is_valid());
+
+	Array loaded_children = loaded->get_meta("children");
+	REQUIRE(loaded_children.size() == child_count);
+	for (int i = 0; i < child_count; i++) {
+		Ref<Resource> child = loaded_children[i];
+		REQUIRE_MESSAGE(child.is_valid(), vformat("Sub-resource %d should be loaded.", i));
+		PackedFloat32Array values = child->get_meta("values");
+		CHECK_MESSAGE(child->get_name() == itos(i), vformat("Sub-resource %d was loaded with name \"%s\".", i, child->get_name()));
+		REQUIRE_MESSAGE(values.size() == 1000, vformat("Sub-resource %d was loaded with %d values, expected 1000.", i, values.size()));
+		CHECK_MESSAGE(values[999] == i + 999, vformat("Sub-resource %d has last value %f, expected %d.", i, values[999], i + 999));
+		if (i > 0) {
+			CHECK_MESSAGE(Ref<Resource>(child->get_meta("previous")) == Ref<Resource>(loaded_children[i - 1]), vformat("Sub-resource %d should reference sub-resource %d.", i, i - 1));
+		}
+	}
+}
+
+TEST_CASE("[SceneTree][Resource] Cancelling a threaded load that shares a dependency with another one") {
+	// A large dependency gives the cancellation a chance to land while it is being loaded.
+	const int child_count = 256;
+	Ref<Resource> shared = memnew(Resource);
+	Array children;
+	for (int i = 0; i < child_count; i++) {
+		Ref<Resource> child = memnew(Resource);
+		child->set_meta("index", i);
+		children.push_back(child);
+	}
+	shared->set_meta("children", children);
+	const String shared_path = TestUtils::get_temp_path("shared_dependency.tres");
+	REQUIRE(ResourceSaver::save(shared, shared_path, ResourceSaver::FLAG_CHANGE_PATH) == OK);
+
+	Ref<Resource> first = memnew(Resource);
+	first->set_meta("shared", shared);
+	const String first_path = TestUtils::get_temp_path("cancelled_load.tres");
+	REQUIRE(ResourceSaver::save(first, first_path) == OK);
+
+	Ref<Resource> second = memnew(Resource);
+	second->set_meta("shared", shared);
+	const String second_path = TestUtils::get_temp_path("kept_load.tres");
+	REQUIRE(ResourceSaver::save(second, second_path) == OK);
+
+	first = Ref<Resource>();
+	second = Ref<Resource>();
+	shared = Ref<Resource>();
+	ResourceCache::clear_retained();
+	REQUIRE(!ResourceCache::has(shared_path));
+
+	REQUIRE(ResourceLoader::load_threaded_request(first_path) == OK);
+	REQUIRE(ResourceLoader::load_threaded_request(second_path) == OK);
+	CHECK(ResourceLoader::load_threaded_cancel(first_path) == OK);
+	CHECK(ResourceLoader::load_threaded_get_status(first_path) == ResourceLoader::THREAD_LOAD_INVALID_RESOURCE);
+
+	while (ResourceLoader::load_threaded_get_status(second_path) == ResourceLoader::THREAD_LOAD_IN_PROGRESS) {
+		OS::get_singleton()->delay_usec(1000);
+	}
+	Error err = FAILED;
+	Ref<Resource> second_loaded = ResourceLoader::load_threaded_get(second_path, &err);
+	REQUIRE(err == OK);
+	REQUIRE(second_loaded.is_valid());
+	Ref<Resource> shared_loaded = second_loaded->get_meta("shared");
+	REQUIRE(shared_loaded.is_valid());
+	Array loaded_children = shared_loaded->get_meta("children");
+	CHECK_MESSAGE(loaded_children.size() == child_count, "Cancelling a load must not cut short a dependency another load is waiting for.");
+
+	// Requesting the cancelled resource again must load it in full, whether or not it had stopped already.
+	Ref<Resource> first_loaded = ResourceLoader::load(first_path);
+	REQUIRE(first_loaded.is_valid());
+	Ref<Resource> first_shared = first_loaded->get_meta("shared");
+	CHECK(first_shared == shared_loaded);
+
+	ResourceCache::clear_retained();
+}
+
+#ifdef DEBUG_ENABLED
+TEST_CASE("[Resource] Binary cache of text resources") {
+	ResourceFormatLoaderText::set_binary_cache_enabled(true);
+
+	const String path = TestUtils::get_temp_path("binary_cached.tres");
+	const String cache_path = ResourceFormatLoaderText::get_binary_cache_path(ProjectSettings::get_singleton()->localize_path(path));
+	Ref<Resource> resource = memnew(Resource);
+	resource->set_meta("value", 1);
+	REQUIRE(ResourceSaver::save(resource, path) == OK);
+
+	Error err = FAILED;
+	Ref<Resource> loaded = ResourceFormatLoaderText::singleton->load(path, path, &err, false, nullptr, ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(err == OK);
+	REQUIRE(loaded.is_valid());
+	CHECK(int(loaded->get_meta("value")) == 1);
+	CHECK_MESSAGE(FileAccess::exists(cache_path + ".stamp"), "A miss should fill the cache.");
+
+	// Replace the cached copy behind the loader's back, so a hit can be told apart from parsing the text file.
+	Ref<Resource> cached = memnew(Resource);
+	cached->set_meta("value", 2);
+	REQUIRE(ResourceSaver::save(cached, cache_path) == OK);
+	loaded = ResourceFormatLoaderText::singleton->load(path, path, &err, false, nullptr, ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(err == OK);
+	REQUIRE(loaded.is_valid());
+	CHECK_MESSAGE(int(loaded->get_meta("value")) == 2, "An unchanged text file should be loaded from the cache.");
+
+	// Same length and likely the same modification time, only the contents tell the edit apart.
+	resource->set_meta("value", 3);
+	REQUIRE(ResourceSaver::save(resource, path) == OK);
+	loaded = ResourceFormatLoaderText::singleton->load(path, path, &err, false, nullptr, ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(err == OK);
+	REQUIRE(loaded.is_valid());
+	CHECK_MESSAGE(int(loaded->get_meta("value")) == 3, "Editing the text file should invalidate the cache.");
+
+	DirAccess::remove_absolute(cache_path);
+	DirAccess::remove_absolute(cache_path + ".stamp");
+	ResourceFormatLoaderText::set_binary_cache_enabled(false);
+}
+#endif // DEBUG_ENABLED
+
+TEST_CASE("[Resource] Retaining recently used resources within a budget") {
+	const uint64_t previous_budget = ResourceCache::get_retained_budget();
+	ResourceCache::set_retained_budget(3000);
+
+	Ref<Image> image = Image::create_empty(32, 16, false, Image::FORMAT_RGBA8);
+	image->set_path("res://retained_image.res");
+	ResourceCache::retain(image);
+	image = Ref<Image>();
+	CHECK_MESSAGE(ResourceCache::has("res://retained_image.res"), "The resource should be kept alive after being released.");
+	CHECK(ResourceCache::get_retained_size() == 32 * 16 * 4);
+
+	Ref<Resource> resource = memnew(Resource);
+	resource->set_path("res://retained_resource.res");
+	ResourceCache::retain(resource);
+	resource = Ref<Resource>();
+	CHECK_MESSAGE(!ResourceCache::has("res://retained_image.res"), "The least recently used resource should be evicted once over budget.");
+	CHECK(ResourceCache::has("res://retained_resource.res"));
+
+	ResourceCache::clear_retained();
+	CHECK(!ResourceCache::has("res://retained_resource.res"));
+	CHECK(ResourceCache::get_retained_size() == 0);
+
+	ResourceCache::set_retained_budget(previous_budget);
+}
 } // namespace TestResource
 
 #endif // TEST_RESOURCE_H
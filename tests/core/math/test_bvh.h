@@ -0,0 +1,128 @@
+/**************************************************************************/
+/*  test_bvh.h                                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_BVH_H
+#define TEST_BVH_H
+
+#include "core/math/bvh.h"
+
+#include "tests/test_macros.h"
+
+namespace TestBVH {
+
+class PairAnyFunction {
+public:
+	static bool user_pair_check(const int *p_a, const int *p_b) {
+		return true;
+	}
+};
+
+class CullAnyFunction {
+public:
+	static bool user_cull_check(const int *p_a, const int *p_b) {
+		return true;
+	}
+};
+
+typedef BVH_Manager<int, 2, true, 128, PairAnyFunction, CullAnyFunction> PairingBVH;
+
+struct PairEvent {
+	uint32_t a = 0;
+	uint32_t b = 0;
+	bool paired = false;
+};
+
+static void *pair_callback(void *p_userdata, uint32_t p_id_a, int *p_a, int p_subindex_a, uint32_t p_id_b, int *p_b, int p_subindex_b) {
+	((LocalVector<PairEvent> *)p_userdata)->push_back({ p_id_a, p_id_b, true });
+	return nullptr;
+}
+
+static void unpair_callback(void *p_userdata, uint32_t p_id_a, int *p_a, int p_subindex_a, uint32_t p_id_b, int *p_b, int p_subindex_b, void *p_pair_data) {
+	((LocalVector<PairEvent> *)p_userdata)->push_back({ p_id_a, p_id_b, false });
+}
+
+// Lays out a grid of overlapping boxes, then moves whole rows at once so that many items change
+// in the same pass, and returns the pair and unpair callbacks in the order they were sent.
+static LocalVector<PairEvent> simulate_pairing(bool p_parallel, uint32_t *r_parallel_passes) {
+	const int columns = 20;
+	const int rows = 10;
+	LocalVector<int> userdata;
+	userdata.resize(columns * rows);
+
+	LocalVector<PairEvent> events;
+	PairingBVH bvh;
+	bvh.params_set_parallel_pairing(p_parallel);
+	bvh.set_pair_callback(pair_callback, &events);
+	bvh.set_unpair_callback(unpair_callback, &events);
+
+	LocalVector<BVHHandle> handles;
+	for (int i = 0; i < columns * rows; i++) {
+		userdata[i] = i;
+		const AABB aabb(Vector3((i % columns) * 0.9, (i / columns) * 0.9, 0), Vector3(1, 1, 1));
+		handles.push_back(bvh.create(&userdata[i], true, 1, 3, aabb));
+	}
+
+	for (int pass = 1; pass <= 4; pass++) {
+		for (int i = 0; i < columns * rows; i++) {
+			// Even and odd rows slide in opposite directions, so some pairs break and others form.
+			const real_t shift = ((i / columns) % 2 == 0 ? 1.5 : -1.5) * pass;
+			bvh.move(handles[i], AABB(Vector3((i % columns) * 0.9 + shift, (i / columns) * 0.9, 0), Vector3(1, 1, 1)));
+		}
+		bvh.update();
+	}
+
+	*r_parallel_passes = bvh.get_parallel_pairing_pass_count();
+	for (const BVHHandle &handle : handles) {
+		bvh.erase(handle);
+	}
+	return events;
+}
+
+TEST_CASE("[BVH] Parallel pairing sends the same callbacks as serial pairing") {
+	uint32_t serial_passes = 0;
+	uint32_t parallel_passes = 0;
+	LocalVector<PairEvent> serial = simulate_pairing(false, &serial_passes);
+	LocalVector<PairEvent> parallel = simulate_pairing(true, &parallel_passes);
+
+	CHECK(serial_passes == 0);
+	CHECK_MESSAGE(parallel_passes > 0, "Enough items should change at once to go through the parallel path.");
+
+	REQUIRE(serial.size() > 0);
+	REQUIRE(parallel.size() == serial.size());
+	for (uint32_t i = 0; i < serial.size(); i++) {
+		CHECK_MESSAGE(parallel[i].a == serial[i].a, vformat("Event %d pairs item %d, expected %d.", i, parallel[i].a, serial[i].a));
+		CHECK_MESSAGE(parallel[i].b == serial[i].b, vformat("Event %d pairs item %d, expected %d.", i, parallel[i].b, serial[i].b));
+		CHECK_MESSAGE(parallel[i].paired == serial[i].paired, vformat("Event %d should be a%s.", i, serial[i].paired ? " pair" : "n unpair"));
+	}
+}
+
+} // namespace TestBVH
+
+#endif // TEST_BVH_H
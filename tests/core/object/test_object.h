@@ -32,8 +32,10 @@
 #define TEST_OBJECT_H
 
 #include "core/object/class_db.h"
+#include "core/object/message_queue.h"
 #include "core/object/object.h"
 #include "core/object/script_language.h"
+#include "core/os/thread.h"
 
 #include "tests/test_macros.h"
 
@@ -289,6 +291,25 @@ TEST_CASE("[Object] Absent name getter") {
 			"The returned value should equal nil variant.");
 }
 
+class SignalCounterObject : public Object {
+	GDCLASS(SignalCounterObject, Object);
+
+public:
+	int calls = 0;
+	Callable other;
+
+	void count() {
+		calls++;
+	}
+
+	void count_and_disconnect_other(Object *p_emitter) {
+		calls++;
+		if (p_emitter->is_connected("my_custom_signal", other)) {
+			p_emitter->disconnect("my_custom_signal", other);
+		}
+	}
+};
+
 TEST_CASE("[Object] Signals") {
 	Object object;
 
@@ -429,6 +450,47 @@ TEST_CASE("[Object] Signals") {
 		object.get_all_signal_connections(&signal_connections);
 		CHECK(signal_connections.size() == 0);
 	}
+
+	SUBCASE("Connections changed during emission should only apply to the next emission") {
+		SignalCounterObject counter;
+		Callable first = callable_mp(&counter, &SignalCounterObject::count_and_disconnect_other).bind(&object);
+		Callable second = callable_mp(&counter, &SignalCounterObject::count);
+		counter.other = second;
+		object.connect("my_custom_signal", first);
+		object.connect("my_custom_signal", second);
+
+		// The second callable is disconnected by whichever runs first, but still gets this emission.
+		object.emit_signal("my_custom_signal");
+		CHECK(counter.calls == 2);
+		object.emit_signal("my_custom_signal");
+		CHECK(counter.calls == 3);
+
+		object.disconnect("my_custom_signal", first);
+	}
+}
+
+TEST_CASE("[Object] Signal emission to a varying number of connections") {
+	Object object;
+	object.add_user_signal(MethodInfo("my_custom_signal"));
+
+	const int emissions = 16;
+	const int connection_counts[] = { 1, 2, 3, 8 };
+	for (int connection_count : connection_counts) {
+		LocalVector<SignalCounterObject> targets;
+		targets.resize(connection_count);
+		for (SignalCounterObject &target : targets) {
+			object.connect("my_custom_signal", callable_mp(&target, &SignalCounterObject::count));
+		}
+
+		for (int i = 0; i < emissions; i++) {
+			object.emit_signal("my_custom_signal");
+		}
+
+		for (uint32_t i = 0; i < targets.size(); i++) {
+			CHECK_MESSAGE(targets[i].calls == emissions, vformat("Connection %d of %d was called %d times, expected %d.", i, connection_count, targets[i].calls, emissions));
+			object.disconnect("my_custom_signal", callable_mp(&targets[i], &SignalCounterObject::count));
+		}
+	}
 }
 
 class NotificationObject1 : public Object {
@@ -499,6 +561,100 @@ TEST_CASE("[Object] Notification order") { // GH-52325
 	memdelete(test_notification_object);
 }
 
+class DeferredRecorderObject : public Object {
+	GDCLASS(DeferredRecorderObject, Object);
+
+public:
+	LocalVector<LocalVector<int>> received;
+
+	void record(int p_thread, int p_index) {
+		received[p_thread].push_back(p_index);
+	}
+};
+
+struct DeferredPusherData {
+	DeferredRecorderObject *recorder = nullptr;
+	int thread = 0;
+	int count = 0;
+};
+
+static void _push_deferred_calls(void *p_userdata) {
+	DeferredPusherData *data = (DeferredPusherData *)p_userdata;
+	for (int i = 0; i < data->count; i++) {
+		callable_mp(data->recorder, &DeferredRecorderObject::record).call_deferred(data->thread, i);
+	}
+}
+
+TEST_CASE("[Object] Deferred calls from other threads") {
+	const int thread_count = 4;
+	const int calls_per_thread = 10000;
+
+	DeferredRecorderObject recorder;
+	recorder.received.resize(thread_count + 1);
+
+	DeferredPusherData data[thread_count];
+	Thread threads[thread_count];
+	for (int i = 0; i < thread_count; i++) {
+		data[i].recorder = &recorder;
+		data[i].thread = i;
+		data[i].count = calls_per_thread;
+		threads[i].start(_push_deferred_calls, &data[i]);
+	}
+
+	// The main thread keeps pushing to the shared pages meanwhile.
+	DeferredPusherData main_data;
+	main_data.recorder = &recorder;
+	main_data.thread = thread_count;
+	main_data.count = calls_per_thread;
+	_push_deferred_calls(&main_data);
+
+	for (int i = 0; i < thread_count; i++) {
+		threads[i].wait_to_finish();
+	}
+
+	CHECK(MessageQueue::get_singleton()->has_messages());
+	MessageQueue::get_singleton()->flush();
+	CHECK_FALSE(MessageQueue::get_singleton()->has_messages());
+
+	for (int i = 0; i <= thread_count; i++) {
+		CHECK_MESSAGE(recorder.received[i].size() == (uint32_t)calls_per_thread, "Every deferred call should be flushed exactly once.");
+		bool in_order = true;
+		for (uint32_t j = 0; j < recorder.received[i].size(); j++) {
+			if (recorder.received[i][j] != (int)j) {
+				in_order = false;
+				break;
+			}
+		}
+		CHECK_MESSAGE(in_order, "Deferred calls pushed by the same thread should be flushed in push order.");
+	}
+}
+
+TEST_CASE("[Object] Deferred calls from another thread over many flushes") {
+	DeferredRecorderObject recorder;
+	recorder.received.resize(1);
+
+	DeferredPusherData data;
+	data.recorder = &recorder;
+	data.count = 1000; // Spans several pages.
+
+	int buffer_usage = 0;
+	for (int round = 0; round < 32; round++) {
+		recorder.received[0].clear();
+		Thread thread;
+		thread.start(_push_deferred_calls, &data);
+		thread.wait_to_finish();
+		MessageQueue::get_singleton()->flush();
+		CHECK(recorder.received[0].size() == (uint32_t)data.count);
+
+		// Pages freed by a flush are reused by the next thread, so memory stops growing after the first round.
+		if (round == 0) {
+			buffer_usage = MessageQueue::get_singleton()->get_max_buffer_usage();
+		} else {
+			CHECK_MESSAGE(MessageQueue::get_singleton()->get_max_buffer_usage() == buffer_usage, vformat("Round %d grew the message queue to %d bytes, from %d.", round, MessageQueue::get_singleton()->get_max_buffer_usage(), buffer_usage));
+		}
+	}
+}
+
 } // namespace TestObject
 
 #endif // TEST_OBJECT_H
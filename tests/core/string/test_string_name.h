@@ -0,0 +1,89 @@
+/**************************************************************************/
+/*  test_string_name.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_STRING_NAME_H
+#define TEST_STRING_NAME_H
+
+#include "core/object/worker_thread_pool.h"
+#include "core/string/string_name.h"
+
+#include "tests/test_macros.h"
+
+namespace TestStringName {
+
+TEST_CASE("[StringName] Interning") {
+	const String name = "test_string_name_interning";
+	StringName a = name;
+	StringName b = StringName(name.utf8().get_data());
+	StringName c = StringName::search(name);
+
+	CHECK(a == b);
+	CHECK(a == c);
+	CHECK(a == name);
+	CHECK(StringName::search("test_string_name_never_interned") == StringName());
+}
+
+static const int CONTENTION_NAMES = 512;
+static const int CONTENTION_ROUNDS = 64;
+static SafeNumeric<uint32_t> contention_mismatches;
+
+static void contention_task(void *p_userdata, uint32_t p_index) {
+	const Vector<String> &names = *(const Vector<String> *)p_userdata;
+	for (int round = 0; round < CONTENTION_ROUNDS; round++) {
+		for (int i = 0; i < CONTENTION_NAMES; i++) {
+			// Half of the names are shared by all threads, the other half are private.
+			const String &name = (i & 1) ? names[i] : names[i] + "_" + itos(p_index);
+			StringName interned = name;
+			if (interned != StringName::search(name)) {
+				contention_mismatches.increment();
+			}
+		}
+	}
+}
+
+TEST_CASE("[StringName] Concurrent interning") {
+	Vector<String> names;
+	for (int i = 0; i < CONTENTION_NAMES; i++) {
+		names.push_back("test_string_name_contention_" + itos(i));
+	}
+
+	for (int threads = 1; threads <= 64; threads *= 2) {
+		contention_mismatches.set(0);
+
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(contention_task, &names, threads, threads, true);
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+		CHECK_MESSAGE(contention_mismatches.get() == 0, vformat("Names concurrently interned by %d threads should always resolve to the same StringName.", threads));
+	}
+}
+
+} // namespace TestStringName
+
+#endif // TEST_STRING_NAME_H
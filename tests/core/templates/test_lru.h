@@ -94,6 +94,28 @@ TEST_CASE("[LRU] Resize and clear") {
 	CHECK(!lru.has(3));
 	CHECK(!lru.has(4));
 }
+
+TEST_CASE("[LRU] Erase and evict manually") {
+	LRUCache<int, int> lru;
+
+	lru.insert(1, 10);
+	lru.insert(2, 20);
+	lru.insert(3, 30);
+	lru.get(1); // Now 2 is the least recently used.
+
+	CHECK(lru.get_back_key() == 2);
+	CHECK(lru.get_back() == 20);
+
+	lru.pop_back();
+	CHECK(!lru.has(2));
+	CHECK(lru.get_size() == 2);
+	CHECK(lru.get_back_key() == 3);
+
+	CHECK(lru.erase(3));
+	CHECK(!lru.erase(3));
+	CHECK(lru.get_size() == 1);
+	CHECK(lru.get_back_key() == 1);
+}
 } // namespace TestLRU
 
 #endif // TEST_LRU_H
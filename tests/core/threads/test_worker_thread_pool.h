@@ -173,6 +173,178 @@ TEST_CASE("[WorkerThreadPool] Run a yielding daemon as the only hope for other t
 	CHECK_MESSAGE(all_needed_yield, "All legit tasks should have needed the daemon yielding to run.");
 }
 
+static void static_stage_group_test(void *p_arg, uint32_t p_index) {
+	// Every element of a stage must see the previous stage fully done.
+	int stage = (int)(uintptr_t)p_arg;
+	if (counter[0].get() < stage * 16) {
+		counter[1].increment();
+	}
+	counter[2].increment();
+}
+
+static void static_stage_test(void *p_arg) {
+	int stage = (int)(uintptr_t)p_arg;
+	if (counter[2].get() < stage * 16) {
+		counter[1].increment();
+	}
+	counter[0].add(16);
+}
+
+TEST_CASE("[WorkerThreadPool] Run tasks and group tasks after their dependencies") {
+	for (int iterations = 0; iterations < 100; iterations++) {
+		counter.clear();
+		counter.resize(3);
+
+		// Alternate single tasks and 16 element groups, each depending on the previous one.
+		const int stages = 8;
+		LocalVector<WorkerThreadPool::TaskID> task_ids;
+		LocalVector<WorkerThreadPool::GroupID> group_ids;
+		Vector<WorkerThreadPool::TaskID> previous;
+		for (int i = 0; i < stages; i++) {
+			WorkerThreadPool::TaskID task_id = WorkerThreadPool::get_singleton()->add_native_task_with_dependencies(static_stage_test, (void *)(uintptr_t)i, previous, i % 2 == 0);
+			task_ids.push_back(task_id);
+			previous.clear();
+			previous.push_back(task_id);
+
+			WorkerThreadPool::GroupID group_id = WorkerThreadPool::get_singleton()->add_native_group_task_with_dependencies(static_stage_group_test, (void *)(uintptr_t)(i + 1), 16, previous, -1, i % 4 < 2);
+			group_ids.push_back(group_id);
+			previous.clear();
+			previous.push_back(group_id);
+		}
+
+		// Waiting on the last one first must not release anything out of order.
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_ids[stages - 1]);
+		CHECK(counter[0].get() == stages * 16);
+		CHECK(counter[2].get() == stages * 16);
+		CHECK_MESSAGE(counter[1].get() == 0, "No task should run before its dependencies complete.");
+
+		for (int i = 0; i < stages; i++) {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(task_ids[i]);
+			if (i < stages - 1) {
+				WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_ids[i]);
+			}
+		}
+	}
+}
+
+static SafeFlag release_dependency;
+
+static void static_dependency_test(void *p_arg) {
+	while (!release_dependency.is_set()) {
+		OS::get_singleton()->delay_usec(1);
+	}
+	counter[0].increment();
+}
+
+TEST_CASE("[WorkerThreadPool] Complete an empty group task after its dependencies") {
+	counter.clear();
+	counter.resize(1);
+	release_dependency.clear();
+
+	WorkerThreadPool::TaskID task_id = WorkerThreadPool::get_singleton()->add_native_task(static_dependency_test, nullptr, true);
+	Vector<WorkerThreadPool::TaskID> dependencies;
+	dependencies.push_back(task_id);
+	WorkerThreadPool::GroupID group_id = WorkerThreadPool::get_singleton()->add_native_group_task_with_dependencies(static_stage_group_test, nullptr, 0, dependencies);
+	CHECK_MESSAGE(!WorkerThreadPool::get_singleton()->is_group_task_completed(group_id), "An empty group should not complete before its dependencies.");
+
+	release_dependency.set();
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_id);
+	CHECK_MESSAGE(counter[0].get() == 1, "Waiting for an empty group should also wait for its dependencies.");
+	WorkerThreadPool::get_singleton()->wait_for_task_completion(task_id);
+}
+
+static SafeFlag release_first_blocker;
+static Mutex run_order_mutex;
+static LocalVector<int> run_order;
+
+static void static_blocker_task(void *p_arg) {
+	const bool first = (uintptr_t)p_arg == 0;
+	while (!exit.is_set() && !(first && release_first_blocker.is_set())) {
+		OS::get_singleton()->delay_usec(1);
+	}
+}
+
+static void static_record_order_task(void *p_arg) {
+	MutexLock lock(run_order_mutex);
+	run_order.push_back((int)(uintptr_t)p_arg);
+}
+
+TEST_CASE("[WorkerThreadPool] Reorder queued low priority tasks") {
+	const int num_threads = WorkerThreadPool::get_singleton()->get_thread_count();
+	if (num_threads < 2) {
+		return; // Low priority tasks can't be held back with a single thread.
+	}
+
+	exit.clear();
+	release_first_blocker.clear();
+	run_order.clear();
+
+	// There are fewer low priority slots than threads, so this fills all of them and queues the rest.
+	LocalVector<WorkerThreadPool::TaskID> blocker_ids;
+	for (int i = 0; i < num_threads; i++) {
+		blocker_ids.push_back(WorkerThreadPool::get_singleton()->add_native_task(static_blocker_task, (void *)(uintptr_t)i));
+	}
+
+	// Queued in ascending order, then raised so that the last one queued becomes the most urgent.
+	const int count = 16;
+	LocalVector<WorkerThreadPool::TaskID> task_ids;
+	for (int i = 0; i < count; i++) {
+		task_ids.push_back(WorkerThreadPool::get_singleton()->add_native_task(static_record_order_task, (void *)(uintptr_t)i));
+	}
+	for (int i = 0; i < count; i++) {
+		WorkerThreadPool::get_singleton()->set_task_priority(task_ids[i], i + 1);
+	}
+
+	// A single slot frees up, so the queued tasks run one after another.
+	release_first_blocker.set();
+	for (int i = 0; i < count; i++) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(task_ids[i]);
+	}
+	exit.set();
+	for (uint32_t i = 0; i < blocker_ids.size(); i++) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(blocker_ids[i]);
+	}
+
+	REQUIRE(run_order.size() == (uint32_t)count);
+	for (int i = 0; i < count; i++) {
+		CHECK_MESSAGE(run_order[i] == count - 1 - i, vformat("Task %d ran at position %d, expected %d.", run_order[i], i, count - 1 - run_order[i]));
+	}
+}
+
+static const int NESTED_TASKS_PER_PRODUCER = 256;
+
+static void static_nested_task(void *p_arg) {
+	counter[0].increment();
+}
+
+static void static_producer_task(void *p_arg) {
+	WorkerThreadPool::TaskID ids[NESTED_TASKS_PER_PRODUCER];
+	for (int i = 0; i < NESTED_TASKS_PER_PRODUCER; i++) {
+		ids[i] = WorkerThreadPool::get_singleton()->add_native_task(static_nested_task, nullptr, true);
+	}
+	for (int i = 0; i < NESTED_TASKS_PER_PRODUCER; i++) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(ids[i]);
+	}
+}
+
+TEST_CASE("[WorkerThreadPool] Run nested tasks") {
+	// Nested tasks are posted to the producer's local queue and stolen by idle threads.
+	for (int producers = 1; producers <= 64; producers *= 2) {
+		counter.clear();
+		counter.resize(1);
+
+		LocalVector<WorkerThreadPool::TaskID> producer_ids;
+		for (int i = 0; i < producers; i++) {
+			producer_ids.push_back(WorkerThreadPool::get_singleton()->add_native_task(static_producer_task, nullptr, true));
+		}
+		for (WorkerThreadPool::TaskID id : producer_ids) {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(id);
+		}
+
+		CHECK_MESSAGE(counter[0].get() == producers * NESTED_TASKS_PER_PRODUCER, vformat("All nested tasks of %d producers should have run.", producers));
+	}
+}
+
 } // namespace TestWorkerThreadPool
 
 #endif // TEST_WORKER_THREAD_POOL_H
@@ -1755,6 +1755,59 @@ TEST_CASE("[Variant] Writer and parser array") {
 	CHECK_MESSAGE(a_parsed == Variant(a), "Should parse back.");
 }
 
+TEST_CASE("[Variant] Writer and parser packed arrays") {
+	// Large enough to cross the parser's read-ahead buffer several times.
+	PackedFloat32Array floats;
+	PackedInt32Array ints;
+	PackedVector3Array vectors;
+	for (int i = 0; i < 2000; i++) {
+		floats.push_back(i * 0.25f - 100.0f);
+		ints.push_back(i * 7919 - 1000000);
+		vectors.push_back(Vector3(i, -i * 0.5f, i % 3 == 0 ? INFINITY : 1.0f));
+	}
+
+	String errs;
+	int line = 1;
+	Variant parsed;
+	String str;
+	VariantParser::StreamString ss;
+
+	VariantWriter::write_to_string(floats, str);
+	ss.s = str;
+	CHECK(VariantParser::parse(&ss, parsed, errs, line) == OK);
+	CHECK_MESSAGE(parsed == Variant(floats), "Should parse back.");
+
+	VariantWriter::write_to_string(ints, str);
+	VariantParser::StreamString ss_ints;
+	ss_ints.s = str;
+	CHECK(VariantParser::parse(&ss_ints, parsed, errs, line) == OK);
+	CHECK_MESSAGE(parsed == Variant(ints), "Should parse back.");
+
+	VariantWriter::write_to_string(vectors, str);
+	VariantParser::StreamString ss_vectors;
+	ss_vectors.s = str;
+	CHECK(VariantParser::parse(&ss_vectors, parsed, errs, line) == OK);
+	CHECK_MESSAGE(parsed == Variant(vectors), "Should parse back, including infinite components.");
+
+	VariantParser::StreamString ss_doubles;
+	ss_doubles.s = "PackedFloat64Array(1e-05, 0.1,\n-2.5e+10, 123456789012345678, 3.14159265358979, 7)";
+	line = 1;
+	CHECK(VariantParser::parse(&ss_doubles, parsed, errs, line) == OK);
+	PackedFloat64Array doubles = parsed;
+	REQUIRE(doubles.size() == 6);
+	CHECK(doubles[0] == 1e-05);
+	CHECK(doubles[1] == 0.1);
+	CHECK(doubles[2] == -2.5e+10);
+	CHECK(doubles[3] == 123456789012345678.0);
+	CHECK(doubles[4] == 3.14159265358979);
+	CHECK(doubles[5] == 7.0);
+	CHECK_MESSAGE(line == 2, "Newlines inside the array should be counted.");
+
+	VariantParser::StreamString ss_trailing;
+	ss_trailing.s = "PackedFloat32Array(1, 2,)";
+	CHECK_MESSAGE(VariantParser::parse(&ss_trailing, parsed, errs, line) == ERR_PARSE_ERROR, "A trailing comma should be rejected.");
+}
+
 TEST_CASE("[Variant] Writer recursive array") {
 	// There is no way to accurately represent a recursive array,
 	// the only thing we can do is make sure the writer doesn't blow up
@@ -31,6 +31,9 @@
 #ifndef TEST_PACKED_SCENE_H
 #define TEST_PACKED_SCENE_H
 
+#include "scene/2d/node_2d.h"
+#include "scene/gui/control.h"
+#include "scene/main/timer.h"
 #include "scene/resources/packed_scene.h"
 
 #include "tests/test_macros.h"
@@ -150,6 +153,116 @@ TEST_CASE("[PackedScene] Instantiate Packed Scene With Children") {
 	memdelete(instance);
 }
 
+TEST_CASE("[PackedScene] Instantiate Packed Scene Repeatedly") {
+	// Create a scene to pack, with properties and connections to restore.
+	Node2D *scene = memnew(Node2D);
+	scene->set_name("TestScene");
+	scene->set_position(Vector2(10, 20));
+
+	Timer *timer = memnew(Timer);
+	timer->set_name("Timer");
+	timer->set_wait_time(2.5);
+	timer->set_one_shot(true);
+	scene->add_child(timer);
+	timer->set_owner(scene);
+	timer->connect("timeout", Callable(scene, "set_name").bind("Fired"), Object::CONNECT_PERSIST);
+
+	Control *control = memnew(Control);
+	control->set_name("Control");
+	control->set_offset(SIDE_RIGHT, 32); // Indexed property.
+	scene->add_child(control);
+	control->set_owner(scene);
+
+	PackedScene packed_scene;
+	packed_scene.pack(scene);
+
+	// After the first one, instantiation goes through the precomputed plan.
+	for (int i = 0; i < 100; i++) {
+		Node2D *instance = Object::cast_to<Node2D>(packed_scene.instantiate());
+		REQUIRE(instance != nullptr);
+
+		Timer *instance_timer = Object::cast_to<Timer>(instance->get_node(NodePath("Timer")));
+		Control *instance_control = Object::cast_to<Control>(instance->get_node(NodePath("Control")));
+		REQUIRE_MESSAGE(instance_timer != nullptr, vformat("Instance %d should have its Timer.", i));
+		REQUIRE_MESSAGE(instance_control != nullptr, vformat("Instance %d should have its Control.", i));
+		CHECK_MESSAGE(instance->get_position() == Vector2(10, 20), vformat("Instance %d has position %s.", i, instance->get_position()));
+		CHECK_MESSAGE(instance_timer->get_wait_time() == 2.5, vformat("Instance %d has wait time %f.", i, instance_timer->get_wait_time()));
+		CHECK_MESSAGE(instance_timer->is_one_shot(), vformat("Instance %d should have a one-shot Timer.", i));
+		CHECK_MESSAGE(instance_control->get_offset(SIDE_RIGHT) == 32, vformat("Instance %d has right offset %f.", i, instance_control->get_offset(SIDE_RIGHT)));
+
+		instance_timer->emit_signal("timeout");
+		CHECK_MESSAGE(instance->get_name() == "Fired", vformat("Instance %d should have its Timer connection set up.", i));
+
+		memdelete(instance);
+	}
+
+	// Changes to the state must be picked up by later instances.
+	timer->set_wait_time(1.0);
+	packed_scene.pack(scene);
+	Node *instance = packed_scene.instantiate();
+	REQUIRE(instance != nullptr);
+	CHECK(Object::cast_to<Timer>(instance->get_node(NodePath("Timer")))->get_wait_time() == 1.0);
+
+	memdelete(instance);
+	memdelete(scene);
+}
+
+TEST_CASE("[PackedScene] Reuse Released Instances") {
+	Node2D *scene = memnew(Node2D);
+	scene->set_name("TestScene");
+	scene->set_position(Vector2(10, 20));
+
+	Timer *timer = memnew(Timer);
+	timer->set_name("Timer");
+	timer->set_wait_time(2.5);
+	scene->add_child(timer);
+	timer->set_owner(scene);
+
+	PackedScene packed_scene;
+	packed_scene.pack(scene);
+
+	Node2D *instance = Object::cast_to<Node2D>(packed_scene.instantiate_pooled());
+	REQUIRE(instance != nullptr);
+	Node *parent = memnew(Node);
+	parent->add_child(instance);
+
+	// Change some state, which must not carry over to the reused instance.
+	instance->set_name("Renamed");
+	instance->set_position(Vector2(100, 200));
+	instance->set_rotation(1.0);
+	Object::cast_to<Timer>(instance->get_node(NodePath("Timer")))->set_wait_time(5.0);
+	Node *added = memnew(Node);
+	added->set_name("Added");
+	instance->get_node(NodePath("Timer"))->add_child(added);
+
+	packed_scene.release_instance(instance);
+	CHECK(instance->get_parent() == nullptr);
+	CHECK(packed_scene.get_pooled_instance_count() == 1);
+
+	Node2D *reused = Object::cast_to<Node2D>(packed_scene.instantiate_pooled());
+	CHECK(reused == instance);
+	CHECK(packed_scene.get_pooled_instance_count() == 0);
+	CHECK(reused->get_name() == "TestScene");
+	CHECK(reused->get_position() == Vector2(10, 20));
+	CHECK(reused->get_rotation() == 0.0);
+	CHECK(Object::cast_to<Timer>(reused->get_node(NodePath("Timer")))->get_wait_time() == 2.5);
+	CHECK_MESSAGE(reused->get_node(NodePath("Timer"))->get_child_count() == 0, "Children added after instantiation should be freed.");
+
+	// A new instance is made when the pool is empty, and a full pool can be shrunk.
+	Node *another = packed_scene.instantiate_pooled();
+	CHECK(another != reused);
+	packed_scene.release_instance(reused);
+	packed_scene.release_instance(another);
+	CHECK(packed_scene.get_pooled_instance_count() == 2);
+	packed_scene.set_pool_capacity(1);
+	CHECK(packed_scene.get_pooled_instance_count() == 1);
+	packed_scene.clear_pool();
+	CHECK(packed_scene.get_pooled_instance_count() == 0);
+
+	memdelete(parent);
+	memdelete(scene);
+}
+
 TEST_CASE("[PackedScene] Set Path") {
 	// Create a scene to pack.
 	Node *scene = memnew(Node);
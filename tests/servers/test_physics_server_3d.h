@@ -0,0 +1,523 @@
+/**************************************************************************/
+/*  test_physics_server_3d.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_PHYSICS_SERVER_3D_H
+#define TEST_PHYSICS_SERVER_3D_H
+
+#include "servers/physics_server_3d.h"
+
+#include "tests/test_macros.h"
+
+namespace TestPhysicsServer3D {
+
+// Static box of half extents 1 at the origin and static sphere of radius 1 at (4, 0, 0).
+struct TestSpace {
+	RID space;
+	RID box_shape;
+	RID sphere_shape;
+	RID box_body;
+	RID sphere_body;
+
+	TestSpace() {
+		PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+		space = ps->space_create();
+
+		box_shape = ps->box_shape_create();
+		ps->shape_set_data(box_shape, Vector3(1, 1, 1));
+		sphere_shape = ps->sphere_shape_create();
+		ps->shape_set_data(sphere_shape, 1.0);
+
+		box_body = ps->body_create();
+		ps->body_set_mode(box_body, PhysicsServer3D::BODY_MODE_STATIC);
+		ps->body_add_shape(box_body, box_shape);
+		ps->body_set_collision_layer(box_body, 1);
+		ps->body_set_space(box_body, space);
+
+		sphere_body = ps->body_create();
+		ps->body_set_mode(sphere_body, PhysicsServer3D::BODY_MODE_STATIC);
+		ps->body_add_shape(sphere_body, sphere_shape);
+		ps->body_set_collision_layer(sphere_body, 2);
+		ps->body_set_state(sphere_body, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(4, 0, 0)));
+		ps->body_set_space(sphere_body, space);
+	}
+
+	~TestSpace() {
+		PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+		ps->free(box_body);
+		ps->free(sphere_body);
+		ps->free(box_shape);
+		ps->free(sphere_shape);
+		ps->free(space);
+	}
+};
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Batched ray queries match single queries") {
+	TestSpace test_space;
+	PhysicsDirectSpaceState3D *space_state = PhysicsServer3D::get_singleton()->space_get_direct_state(test_space.space);
+	REQUIRE(space_state != nullptr);
+
+	// Enough rays to be split in several chunks.
+	const int ray_count = 300;
+	Vector<Vector3> from;
+	Vector<Vector3> to;
+	Vector<uint32_t> masks;
+	for (int i = 0; i < ray_count; i++) {
+		real_t x = -2.0 + 7.0 * i / ray_count;
+		from.push_back(Vector3(x, 5, 0.5));
+		to.push_back(Vector3(x, -5, 0.5));
+		masks.push_back(i % 3 == 0 ? 1 : 3);
+	}
+
+	PhysicsDirectSpaceState3D::RayParameters parameters;
+	Vector<PhysicsDirectSpaceState3D::RayResult> results;
+	results.resize(ray_count);
+	Vector<bool> hits;
+	hits.resize(ray_count);
+	space_state->intersect_rays(parameters, from.ptr(), to.ptr(), masks.ptr(), ray_count, results.ptrw(), hits.ptrw());
+
+	int hit_count = 0;
+	for (int i = 0; i < ray_count; i++) {
+		parameters.from = from[i];
+		parameters.to = to[i];
+		parameters.collision_mask = masks[i];
+		PhysicsDirectSpaceState3D::RayResult expected;
+		bool expected_hit = space_state->intersect_ray(parameters, expected);
+
+		CHECK(hits[i] == expected_hit);
+		if (expected_hit && hits[i]) {
+			hit_count++;
+			CHECK(results[i].rid == expected.rid);
+			CHECK(results[i].shape == expected.shape);
+			CHECK(results[i].position.is_equal_approx(expected.position));
+			CHECK(results[i].normal.is_equal_approx(expected.normal));
+		}
+		if (masks[i] == 1 && from[i].x > 3) {
+			CHECK_FALSE(hits[i]);
+		}
+	}
+	CHECK(hit_count > 0);
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Batched shape queries match single queries") {
+	TestSpace test_space;
+	PhysicsDirectSpaceState3D *space_state = PhysicsServer3D::get_singleton()->space_get_direct_state(test_space.space);
+	REQUIRE(space_state != nullptr);
+
+	RID query_shape = PhysicsServer3D::get_singleton()->sphere_shape_create();
+	PhysicsServer3D::get_singleton()->shape_set_data(query_shape, 0.5);
+
+	const int query_count = 150;
+	Vector<Transform3D> transforms;
+	Vector<Vector3> motions;
+	for (int i = 0; i < query_count; i++) {
+		transforms.push_back(Transform3D(Basis(), Vector3(-3.0 + 9.0 * i / query_count, 3, 0)));
+		motions.push_back(Vector3(0, -6, 0));
+	}
+
+	PhysicsDirectSpaceState3D::ShapeParameters parameters;
+	parameters.shape_rid = query_shape;
+
+	SUBCASE("intersect_shapes") {
+		const int result_max = 4;
+		Vector<PhysicsDirectSpaceState3D::ShapeResult> results;
+		results.resize(query_count * result_max);
+		Vector<int> counts;
+		counts.resize(query_count);
+
+		Vector<Transform3D> low_transforms;
+		for (int i = 0; i < query_count; i++) {
+			low_transforms.push_back(transforms[i].translated(Vector3(0, -3, 0)));
+		}
+		space_state->intersect_shapes(parameters, low_transforms.ptr(), query_count, results.ptrw(), result_max, counts.ptrw());
+
+		int total = 0;
+		for (int i = 0; i < query_count; i++) {
+			parameters.transform = low_transforms[i];
+			PhysicsDirectSpaceState3D::ShapeResult expected[result_max];
+			int expected_count = space_state->intersect_shape(parameters, expected, result_max);
+			CHECK(counts[i] == expected_count);
+			for (int j = 0; j < MIN(counts[i], expected_count); j++) {
+				CHECK(results[i * result_max + j].rid == expected[j].rid);
+			}
+			total += counts[i];
+		}
+		CHECK(total > 0);
+	}
+
+	SUBCASE("cast_motions") {
+		Vector<real_t> closest_safe;
+		closest_safe.resize(query_count);
+		Vector<real_t> closest_unsafe;
+		closest_unsafe.resize(query_count);
+		CHECK(space_state->cast_motions(parameters, transforms.ptr(), motions.ptr(), query_count, closest_safe.ptrw(), closest_unsafe.ptrw()));
+
+		for (int i = 0; i < query_count; i++) {
+			parameters.transform = transforms[i];
+			parameters.motion = motions[i];
+			real_t expected_safe = 1.0;
+			real_t expected_unsafe = 1.0;
+			CHECK(space_state->cast_motion(parameters, expected_safe, expected_unsafe));
+			CHECK(closest_safe[i] == doctest::Approx(expected_safe));
+			CHECK(closest_unsafe[i] == doctest::Approx(expected_unsafe));
+		}
+		// The sphere right above the box stops before touching it.
+		CHECK(closest_safe[query_count / 3] < 1.0);
+	}
+
+	PhysicsServer3D::get_singleton()->free(query_shape);
+}
+
+// Drops a fixed pile of boxes, spheres, capsules and cylinders on a floor and returns the final body transforms.
+// The scene only depends on its inputs, so it doubles as a benchmark for the primitive narrow phase.
+static Vector<Transform3D> simulate_primitive_pile(int p_layers, int p_steps) {
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+
+	LocalVector<RID> shapes;
+	RID floor_shape = ps->box_shape_create();
+	ps->shape_set_data(floor_shape, Vector3(20, 1, 20));
+	shapes.push_back(floor_shape);
+
+	RID box_shape = ps->box_shape_create();
+	ps->shape_set_data(box_shape, Vector3(0.5, 0.5, 0.5));
+	shapes.push_back(box_shape);
+	RID sphere_shape = ps->sphere_shape_create();
+	ps->shape_set_data(sphere_shape, 0.5);
+	shapes.push_back(sphere_shape);
+	RID capsule_shape = ps->capsule_shape_create();
+	Dictionary capsule_data;
+	capsule_data["radius"] = 0.4;
+	capsule_data["height"] = 1.4;
+	ps->shape_set_data(capsule_shape, capsule_data);
+	shapes.push_back(capsule_shape);
+	RID cylinder_shape = ps->cylinder_shape_create();
+	Dictionary cylinder_data;
+	cylinder_data["radius"] = 0.5;
+	cylinder_data["height"] = 1.0;
+	ps->shape_set_data(cylinder_shape, cylinder_data);
+	shapes.push_back(cylinder_shape);
+
+	RID floor = ps->body_create();
+	ps->body_set_mode(floor, PhysicsServer3D::BODY_MODE_STATIC);
+	ps->body_add_shape(floor, floor_shape);
+	ps->body_set_state(floor, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(0, -1, 0)));
+	ps->body_set_space(floor, space);
+
+	LocalVector<RID> bodies;
+	const RID pile_shapes[4] = { box_shape, sphere_shape, capsule_shape, cylinder_shape };
+	for (int y = 0; y < p_layers; y++) {
+		for (int x = 0; x < 4; x++) {
+			for (int z = 0; z < 4; z++) {
+				RID body = ps->body_create();
+				ps->body_add_shape(body, pile_shapes[(x + y + z) % 4]);
+				Basis basis = Basis::from_euler(Vector3(0.1 * x, 0.2 * y, 0.3 * z));
+				ps->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(basis, Vector3(x * 1.1 - 1.65, 0.75 + y * 1.6, z * 1.1 - 1.65)));
+				ps->body_set_space(body, space);
+				bodies.push_back(body);
+			}
+		}
+	}
+
+	for (int i = 0; i < p_steps; i++) {
+		ps->step(1.0 / 60.0);
+	}
+
+	Vector<Transform3D> transforms;
+	for (const RID &body : bodies) {
+		transforms.push_back(ps->body_get_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM));
+		ps->free(body);
+	}
+	ps->free(floor);
+	for (const RID &shape : shapes) {
+		ps->free(shape);
+	}
+	ps->space_set_active(space, false);
+	ps->free(space);
+
+	return transforms;
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Primitive pile settles deterministically") {
+	int layers = 4;
+	SUBCASE("Small pile") {
+		layers = 4;
+	}
+	SUBCASE("Large pile") {
+		// Enough bodies move each step for broadphase pairing to run in parallel, see TestBVH.
+		layers = 10;
+	}
+
+	Vector<Transform3D> first = simulate_primitive_pile(layers, 180);
+	Vector<Transform3D> second = simulate_primitive_pile(layers, 180);
+
+	REQUIRE(first.size() == 4 * 4 * layers);
+	REQUIRE(second.size() == first.size());
+
+	for (int i = 0; i < first.size(); i++) {
+		CHECK_MESSAGE(first[i] == second[i], vformat("Body %d ended at %s and then at %s when stepping the same scene twice.", i, first[i], second[i]));
+		// Nothing may sink into the floor, whose top is at y = 0.
+		CHECK_MESSAGE(first[i].origin.y > 0.2, vformat("Body %d sank to y = %f instead of resting on the floor or on other bodies.", i, first[i].origin.y));
+	}
+}
+
+// Stacks unit boxes on a floor with a heavier box resting off-center on top, and returns how far
+// any of them ended up from its resting position.
+static real_t simulate_box_stack(PhysicsServer3D::SpaceSolverType p_solver_type, int p_solver_iterations, int p_height, int p_steps) {
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+	ps->space_set_param(space, PhysicsServer3D::SPACE_PARAM_SOLVER_TYPE, p_solver_type);
+	ps->space_set_param(space, PhysicsServer3D::SPACE_PARAM_SOLVER_ITERATIONS, p_solver_iterations);
+	CHECK(ps->space_get_param(space, PhysicsServer3D::SPACE_PARAM_SOLVER_TYPE) == p_solver_type);
+
+	RID floor_shape = ps->box_shape_create();
+	ps->shape_set_data(floor_shape, Vector3(20, 1, 20));
+	RID box_shape = ps->box_shape_create();
+	ps->shape_set_data(box_shape, Vector3(0.5, 0.5, 0.5));
+
+	RID floor = ps->body_create();
+	ps->body_set_mode(floor, PhysicsServer3D::BODY_MODE_STATIC);
+	ps->body_add_shape(floor, floor_shape);
+	ps->body_set_state(floor, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(0, -1, 0)));
+	ps->body_set_space(floor, space);
+
+	LocalVector<RID> boxes;
+	for (int i = 0; i < p_height; i++) {
+		RID box = ps->body_create();
+		ps->body_add_shape(box, box_shape);
+		ps->body_set_state(box, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(0, 0.5 + i * 1.01, 0)));
+		ps->body_set_space(box, space);
+		boxes.push_back(box);
+	}
+
+	// The load presses on one side of the stack, so the contacts under it don't share the weight evenly.
+	const Vector3 load_offset(0.3, 0, 0.2);
+	RID load = ps->body_create();
+	ps->body_add_shape(load, box_shape);
+	ps->body_set_param(load, PhysicsServer3D::BODY_PARAM_MASS, 5.0);
+	ps->body_set_state(load, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), load_offset + Vector3(0, 0.5 + p_height * 1.01, 0)));
+	ps->body_set_space(load, space);
+	boxes.push_back(load);
+
+	for (int i = 0; i < p_steps; i++) {
+		ps->step(1.0 / 60.0);
+	}
+
+	real_t drift = 0.0;
+	for (int i = 0; i <= p_height; i++) {
+		Vector3 resting_position = Vector3(0, 0.5 + i, 0) + (i == p_height ? load_offset : Vector3());
+		Transform3D xform = ps->body_get_state(boxes[i], PhysicsServer3D::BODY_STATE_TRANSFORM);
+		drift = MAX(drift, xform.origin.distance_to(resting_position));
+	}
+
+	for (const RID &box : boxes) {
+		ps->free(box);
+	}
+	ps->free(floor);
+	ps->free(box_shape);
+	ps->free(floor_shape);
+	ps->space_set_active(space, false);
+	ps->free(space);
+
+	return drift;
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Block solver keeps a box stack upright") {
+	const int height = 6;
+	const int steps = 300;
+
+	// Both with half the default iterations, the default solver being the baseline.
+	real_t sequential_drift = simulate_box_stack(PhysicsServer3D::SPACE_SOLVER_TYPE_SEQUENTIAL_IMPULSE, 8, height, steps);
+	real_t block_drift = simulate_box_stack(PhysicsServer3D::SPACE_SOLVER_TYPE_BLOCK, 8, height, steps);
+
+	CHECK_MESSAGE(block_drift < 0.1, vformat("The block solver should keep the loaded stack standing with half the iterations (drift: %f).", block_drift));
+	CHECK_MESSAGE(block_drift < sequential_drift, vformat("The block solver should drift less than the default solver with as many iterations (%f vs %f).", block_drift, sequential_drift));
+}
+
+// Heightmap on layer 1 and a concave polygon shape with the same triangles on layer 2, both at the origin.
+// Large enough for the heightmap quadtree to have several levels, and not a multiple of its chunk size.
+struct TestTerrain {
+	static const int SIZE = 161;
+
+	RID space;
+	RID heightmap_shape;
+	RID mesh_shape;
+	RID heightmap_body;
+	RID mesh_body;
+
+	static real_t get_height(int p_x, int p_z) {
+		return 4.0 * Math::sin(p_x * 0.15) * Math::cos(p_z * 0.1) + 0.02 * ((p_x * 7 + p_z * 13) % 11);
+	}
+
+	static Vector3 get_point(int p_x, int p_z) {
+		return Vector3(p_x - 0.5 * (SIZE - 1), get_height(p_x, p_z), p_z - 0.5 * (SIZE - 1));
+	}
+
+	TestTerrain() {
+		PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+		space = ps->space_create();
+
+		PackedFloat32Array heights;
+		real_t min_height = 0.0;
+		real_t max_height = 0.0;
+		for (int z = 0; z < SIZE; z++) {
+			for (int x = 0; x < SIZE; x++) {
+				real_t height = get_height(x, z);
+				heights.push_back(height);
+				min_height = MIN(min_height, height);
+				max_height = MAX(max_height, height);
+			}
+		}
+
+		Dictionary heightmap_data;
+		heightmap_data["width"] = SIZE;
+		heightmap_data["depth"] = SIZE;
+		heightmap_data["heights"] = heights;
+		heightmap_data["min_height"] = min_height;
+		heightmap_data["max_height"] = max_height;
+		heightmap_shape = ps->heightmap_shape_create();
+		ps->shape_set_data(heightmap_shape, heightmap_data);
+
+		PackedVector3Array faces;
+		for (int z = 0; z < SIZE - 1; z++) {
+			for (int x = 0; x < SIZE - 1; x++) {
+				faces.push_back(get_point(x, z));
+				faces.push_back(get_point(x + 1, z));
+				faces.push_back(get_point(x, z + 1));
+				faces.push_back(get_point(x + 1, z));
+				faces.push_back(get_point(x + 1, z + 1));
+				faces.push_back(get_point(x, z + 1));
+			}
+		}
+
+		Dictionary mesh_data;
+		mesh_data["faces"] = faces;
+		mesh_data["backface_collision"] = false;
+		mesh_shape = ps->concave_polygon_shape_create();
+		ps->shape_set_data(mesh_shape, mesh_data);
+
+		heightmap_body = ps->body_create();
+		ps->body_set_mode(heightmap_body, PhysicsServer3D::BODY_MODE_STATIC);
+		ps->body_add_shape(heightmap_body, heightmap_shape);
+		ps->body_set_collision_layer(heightmap_body, 1);
+		ps->body_set_space(heightmap_body, space);
+
+		mesh_body = ps->body_create();
+		ps->body_set_mode(mesh_body, PhysicsServer3D::BODY_MODE_STATIC);
+		ps->body_add_shape(mesh_body, mesh_shape);
+		ps->body_set_collision_layer(mesh_body, 2);
+		ps->body_set_space(mesh_body, space);
+	}
+
+	~TestTerrain() {
+		PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+		ps->free(heightmap_body);
+		ps->free(mesh_body);
+		ps->free(heightmap_shape);
+		ps->free(mesh_shape);
+		ps->free(space);
+	}
+};
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Heightmap and concave polygon ray queries agree") {
+	TestTerrain terrain;
+	PhysicsDirectSpaceState3D *space_state = PhysicsServer3D::get_singleton()->space_get_direct_state(terrain.space);
+	REQUIRE(space_state != nullptr);
+
+	const real_t extent = 0.5 * (TestTerrain::SIZE - 1);
+	const int ray_count = 400;
+
+	int hit_count = 0;
+	for (int i = 0; i < ray_count; i++) {
+		PhysicsDirectSpaceState3D::RayParameters parameters;
+		if (i % 2 == 0) {
+			// Steep rays, mostly short in the plane.
+			parameters.from = Vector3(extent * Math::sin(i * 1.7), 12, extent * Math::cos(i * 2.3));
+			parameters.to = parameters.from + Vector3(10 * Math::sin(i * 0.9), -24, 10 * Math::cos(i * 1.1));
+		} else {
+			// Long grazing rays crossing many chunks.
+			parameters.from = Vector3(-extent * Math::cos(i * 0.7), 3, extent * Math::sin(i * 1.3));
+			parameters.to = Vector3(extent * Math::cos(i * 0.5), -1, -extent * Math::sin(i * 0.3));
+		}
+
+		PhysicsDirectSpaceState3D::RayResult heightmap_result;
+		parameters.collision_mask = 1;
+		bool heightmap_hit = space_state->intersect_ray(parameters, heightmap_result);
+
+		PhysicsDirectSpaceState3D::RayResult mesh_result;
+		parameters.collision_mask = 2;
+		bool mesh_hit = space_state->intersect_ray(parameters, mesh_result);
+
+		CHECK(heightmap_hit == mesh_hit);
+		if (heightmap_hit && mesh_hit) {
+			hit_count++;
+			CHECK(heightmap_result.position.distance_to(mesh_result.position) < 0.001);
+			CHECK(heightmap_result.normal.distance_to(mesh_result.normal) < 0.001);
+		}
+	}
+	CHECK(hit_count > ray_count / 4);
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Heightmap and concave polygon shape queries agree") {
+	TestTerrain terrain;
+	PhysicsDirectSpaceState3D *space_state = PhysicsServer3D::get_singleton()->space_get_direct_state(terrain.space);
+	REQUIRE(space_state != nullptr);
+
+	RID query_shape = PhysicsServer3D::get_singleton()->sphere_shape_create();
+	PhysicsServer3D::get_singleton()->shape_set_data(query_shape, 0.6);
+
+	PhysicsDirectSpaceState3D::ShapeParameters parameters;
+	parameters.shape_rid = query_shape;
+
+	for (int z = 3; z < TestTerrain::SIZE - 3; z += 17) {
+		for (int x = 5; x < TestTerrain::SIZE - 5; x += 13) {
+			// Slightly below a vertex of the surface, then well above it.
+			for (int above = 0; above < 2; above++) {
+				parameters.transform.origin = TestTerrain::get_point(x, z) + Vector3(0, above ? 1.5 : -0.3, 0);
+
+				PhysicsDirectSpaceState3D::ShapeResult result;
+				parameters.collision_mask = 1;
+				int heightmap_count = space_state->intersect_shape(parameters, &result, 1);
+				parameters.collision_mask = 2;
+				int mesh_count = space_state->intersect_shape(parameters, &result, 1);
+
+				CHECK(heightmap_count == mesh_count);
+				CHECK(heightmap_count == (above ? 0 : 1));
+			}
+		}
+	}
+
+	PhysicsServer3D::get_singleton()->free(query_shape);
+}
+
+} // namespace TestPhysicsServer3D
+
+#endif // TEST_PHYSICS_SERVER_3D_H